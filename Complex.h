@@ -1,6 +1,9 @@
 /**
  * Complex - class to represent a complex number 
  * 
+ * The class is header-only: all the operations are inline (and constexpr where C++11 allows),
+ * so the cell operations of Matrix<Complex> are inlined into the Matrix loops.
+ * The layout is two doubles (real part first), the same as std::complex<double>.
  */
 #ifndef COMPLEX_H
 #define COMPLEX_H
@@ -8,6 +11,8 @@
 #include <string>
 #include <iostream>
 #include <limits>
+#include <complex>
+#include <type_traits>
 
 class Complex
 {
@@ -15,61 +20,107 @@ public:
 	/**
 	* Constructors geting double or default which is set to 0
 	*/
-	Complex(const double  &value = 0);
+	constexpr Complex(const double &value = 0) : _real(value), _imaginary(0) {}
 	/**
 	* Constructors geting real and imaginary part
 	*/
-	Complex(const double  &real, const double &imaginary);
-	/**
-	* Constructors by string "<real> + <imaginary>i"
-	*/
-
-/**
-	* copy Constructor
-	*/
-	Complex(const Complex &other);
-	
+	constexpr Complex(const double &real, const double &imaginary) :
+		_real(real), _imaginary(imaginary) {}
 
-	const Complex conj() const;
+	constexpr Complex conj() const { return Complex(_real, -_imaginary); }
 	/**
 	 * Returns the real part
 	 */
-	 double getReal() const;
+	constexpr double getReal() const { return _real; }
 	/**
 	 * Returns the imaginary part
 	 */
-	 double getImaginary() const;
+	constexpr double getImaginary() const { return _imaginary; }
 
 	/**
 	 * Summing two Complexs
 	 */
-	const Complex operator+(const Complex &other) const;
-	 Complex& operator+=(const Complex &other) ;
-	 const Complex operator-(const Complex &other) const;
-	 Complex& operator-=(const Complex &other) ;
-	
+	constexpr Complex operator+(const Complex &other) const
+	{
+		return Complex(_real + other._real, _imaginary + other._imaginary);
+	}
+	inline Complex& operator+=(const Complex &other);
+	constexpr Complex operator-(const Complex &other) const
+	{
+		return Complex(_real - other._real, _imaginary - other._imaginary);
+	}
+	inline Complex& operator-=(const Complex &other);
+
 	/**
 	 * Multiplying operator for Complex
 	 */
-	const Complex operator*(const Complex &other) const;
-Complex& operator*=(const Complex &other) ;
+	constexpr Complex operator*(const Complex &other) const
+	{
+		return Complex(_real * other._real - _imaginary * other._imaginary,
+					   _real * other._imaginary + _imaginary * other._real);
+	}
+	inline Complex& operator*=(const Complex &other);
 	/**
 	 * operator<< for stream insertion
 	 * The format is <real> + <img>i
 	 */
-	friend std::ostream& operator<<(std::ostream &os, const Complex &number);
+	friend inline std::ostream& operator<<(std::ostream &os, const Complex &number);
 
 	/**
 	 * ==
+	 * Both parts must differ by less than the machine epsilon.
 	 */
-
-	 bool operator==(const Complex &other) const;
-	 bool operator!=(const Complex &other) const;
+	constexpr bool operator==(const Complex &other) const
+	{
+		return _absolute(_real - other._real) < std::numeric_limits<double>::epsilon()
+			   && _absolute(_imaginary - other._imaginary) < std::numeric_limits<double>::epsilon();
+	}
+	constexpr bool operator!=(const Complex &other) const { return !(*this == other); }
 
 private:
 	double _real;
 	double _imaginary;
 
+	/**
+	 * The absolute value of a double, usable in constant expressions
+	 */
+	static constexpr double _absolute(double value) { return value < 0 ? -value : value; }
 };
 
+static_assert(sizeof(Complex) == sizeof(std::complex<double>) &&
+			  std::is_standard_layout<Complex>::value &&
+			  std::is_trivially_copyable<Complex>::value,
+			  "Complex must be layout-compatible with std::complex<double>");
+
+inline Complex& Complex::operator+=(const Complex &other)
+{
+	_real += other._real;
+	_imaginary += other._imaginary;
+	return *this;
+}
+
+inline Complex& Complex::operator-=(const Complex &other)
+{
+	_real -= other._real;
+	_imaginary -= other._imaginary;
+	return *this;
+}
+
+inline Complex& Complex::operator*=(const Complex &other)
+{
+	double r = _real * other._real - _imaginary * other._imaginary;
+	_imaginary = _real * other._imaginary + _imaginary * other._real;
+	_real = r;
+	return *this;
+}
+
+inline std::ostream& operator<<(std::ostream &os, const Complex &number)
+{
+	if (number._imaginary < 0)
+		os << number._real << " - " << -number._imaginary << "i";
+	else
+		os << number._real << " + " << number._imaginary << "i";
+	return os;
+}
+
 #endif
@@ -1,6 +1,14 @@
 /**
  * A driver for testing the implementation of the Matrix.hpp file which is
  * an implementationf of a generic (template) matrix
+ *
+ * Run with --batch [file] to perform many jobs without prompts. The jobs are read
+ * from the file (or the standard input), each of them is a header line
+ * "<int|double|complex> <+|-|*|trans>" followed by it's operand matrices, and each
+ * matrix is a line "<rows> <cols>" followed by it's rows in the usual format.
+ * Empty lines and lines starting with '#' are skipped. The jobs are parsed by one
+ * thread, computed by the thread pool of the Matrix and written in their order,
+ * so the parsing of a job overlaps the computation of the previous jobs.
  */
 #include <iostream>
 #include <cassert>
@@ -10,10 +18,19 @@
 #include <sstream>
 #include <iostream>
 #include <sstream>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 
 #include "Matrix.h"
 #include "Complex.h"
+#include "MatrixThreadPool.h"
 
 #define LINE "=========="
 #define MAT_LINE "--------"
@@ -29,6 +46,15 @@
 
 #define NUM_KNOWN_FIELDS 3
 
+#define BATCH_FLAG "--batch"
+#define BATCH_STDIN "-"
+#define BATCH_COMMENT '#'
+#define BATCH_TRANSPOSE "trans"
+// The number of jobs which may be parsed and not yet written
+#define BATCH_WINDOW 64
+// The largest number of cells in a matrix of a job, so a bad header can't exhaust the memory
+#define BATCH_MAX_CELLS 67108864
+
 const std::string OPERATIONS[6] = {"matrix + matrix", "matrix * matrix", "transpose"};
 const int NUM_OPS = 3;
 
@@ -57,8 +83,77 @@ void getNumFromString(const std::string &str, int *num);
 template <typename T>
 const T readScalarLine();
 
-int main()
+/**
+ * The result of a single job of the batch mode
+ */
+struct BatchResult
 {
+	std::string text;
+	bool failed;
+};
+
+/**
+ * The ordered writer of the batch mode. The jobs are completed in any order, and
+ * written in the order they were parsed. It also bounds the number of jobs in
+ * flight, so the parser doesn't run far ahead of the computation.
+ */
+class BatchWriter
+{
+public:
+	BatchWriter() : _next(0), _inFlight(0), _total(0), _finished(false) {}
+
+	// Wait until another job may be parsed
+	void reserve();
+
+	// Keep the result of the given job
+	void complete(size_t job, const BatchResult &result);
+
+	// Announce that no more jobs will be parsed
+	void finish(size_t total);
+
+	// Write the results in order until all the jobs are written, returns false if
+	// any of them has failed
+	bool write(std::ostream &out);
+
+private:
+	std::mutex _mutex;
+	std::condition_variable _changed;
+	std::map<size_t, BatchResult> _results;
+	size_t _next;
+	size_t _inFlight;
+	size_t _total;
+	bool _finished;
+};
+
+int runBatch(const char *path);
+
+void parseBatch(std::istream &in, BatchWriter &writer);
+
+std::function<void(std::ostream&)> parseBatchJob(const std::string &header, std::istream &in,
+                                                 unsigned long &lineNumber);
+
+template <typename T>
+std::function<void(std::ostream&)> parseBatchOperands(const std::string &op, std::istream &in,
+                                                      unsigned long &lineNumber);
+
+template <typename T>
+std::shared_ptr<Matrix<T>> readBatchMatrix(std::istream &in, unsigned long &lineNumber);
+
+template <typename T>
+bool readBatchCell(const std::string &str, T *num);
+
+bool readBatchCell(const std::string &str, Complex *num);
+
+bool isBlank(std::istream &stream);
+
+bool readBatchLine(std::istream &in, std::string &line, unsigned long &lineNumber);
+
+int main(int argc, char *argv[])
+{
+	if (argc > 1 && std::string(argv[1]) == BATCH_FLAG)
+	{
+		return runBatch(argc > 2 ? argv[2] : BATCH_STDIN);
+	}
 
 	std::cout << "Choose the scalar field of the components of the matrix" << std::endl;
 	std::cout << "(" << INT << " for ints, " << DOUBLE << " for double or " 
@@ -333,3 +428,270 @@ void printResultMatrix(const Matrix<T>& mat)
 	std::cout << mat;
 }
 
+
+
+void BatchWriter::reserve()
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	_changed.wait(lock, [this]() { return _inFlight < BATCH_WINDOW; });
+	_inFlight++;
+}
+
+void BatchWriter::complete(size_t job, const BatchResult &result)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_results[job] = result;
+	_changed.notify_all();
+}
+
+void BatchWriter::finish(size_t total)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_total = total;
+	_finished = true;
+	_changed.notify_all();
+}
+
+bool BatchWriter::write(std::ostream &out)
+{
+	bool succeeded = true;
+	while (true)
+	{
+		BatchResult result;
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_changed.wait(lock, [this]()
+			{
+				return _results.count(_next) || (_finished && _next == _total);
+			});
+			if (_finished && _next == _total)
+			{
+				break;
+			}
+			result = _results[_next];
+			_results.erase(_next);
+			_next++;
+			_inFlight--;
+			_changed.notify_all();
+		}
+		out << result.text;
+		succeeded = succeeded && !result.failed;
+	}
+	out.flush();
+	return succeeded;
+}
+
+int runBatch(const char *path)
+{
+	std::ifstream file;
+	std::istream *in = &std::cin;
+	if (std::string(path) != BATCH_STDIN)
+	{
+		file.open(path);
+		if (!file)
+		{
+			std::cerr << "Cannot open the batch file " << path << std::endl;
+			return EXIT_FAILURE;
+		}
+		in = &file;
+	}
+
+	BatchWriter writer;
+	std::thread parser(parseBatch, std::ref(*in), std::ref(writer));
+	bool succeeded = writer.write(std::cout);
+	parser.join();
+	return succeeded ? 0 : EXIT_FAILURE;
+}
+
+void parseBatch(std::istream &in, BatchWriter &writer)
+{
+	MatrixThreadPool &pool = MatrixThreadPool::shared();
+	size_t job = 0;
+	unsigned long lineNumber = 0;
+	std::string header;
+	while (readBatchLine(in, header, lineNumber))
+	{
+		std::function<void(std::ostream&)> compute;
+		const std::string title = "job " + std::to_string(job + 1) + ": " + header + "\n";
+		writer.reserve();
+		try
+		{
+			compute = parseBatchJob(header, in, lineNumber);
+		}
+		catch (std::exception& exception)
+		{
+			// The rest of the input can't be trusted after a malformed job
+			writer.complete(job++, {title + "Invalid job at line " +
+			                        std::to_string(lineNumber) + ": " + exception.what() + "\n",
+			                        true});
+			break;
+		}
+
+		pool.submit([&writer, job, compute, title]()
+		{
+			std::ostringstream out;
+			bool failed = false;
+			out << title;
+			try
+			{
+				compute(out);
+			}
+			catch (std::exception& exception)
+			{
+				out << "Got Exception from Matrix with message: " << std::endl
+				      << exception.what() << std::endl;
+				failed = true;
+			}
+			writer.complete(job, {out.str(), failed});
+		});
+		job++;
+	}
+	writer.finish(job);
+}
+
+std::function<void(std::ostream&)> parseBatchJob(const std::string &header, std::istream &in,
+                                                 unsigned long &lineNumber)
+{
+	std::istringstream fields(header);
+	std::string type, op, extra;
+	fields >> type >> op;
+	if (op != "+" && op != "-" && op != "*" && op != BATCH_TRANSPOSE)
+	{
+		throw std::runtime_error("unknown operation '" + op + "'");
+	}
+	if (fields >> extra)
+	{
+		throw std::runtime_error("unexpected '" + extra + "'");
+	}
+
+	if (type == "int")
+	{
+		return parseBatchOperands<int>(op, in, lineNumber);
+	}
+	if (type == "double")
+	{
+		return parseBatchOperands<double>(op, in, lineNumber);
+	}
+	if (type == "complex")
+	{
+		return parseBatchOperands<Complex>(op, in, lineNumber);
+	}
+	throw std::runtime_error("unknown type '" + type + "'");
+}
+
+template <typename T>
+std::function<void(std::ostream&)> parseBatchOperands(const std::string &op, std::istream &in,
+                                                      unsigned long &lineNumber)
+{
+	// The operands are shared, so the job is never copied with them
+	std::shared_ptr<Matrix<T>> first = readBatchMatrix<T>(in, lineNumber);
+	if (op == BATCH_TRANSPOSE)
+	{
+		return [first](std::ostream &out) { out << first->trans(); };
+	}
+
+	std::shared_ptr<Matrix<T>> second = readBatchMatrix<T>(in, lineNumber);
+	if (op == "+")
+	{
+		return [first, second](std::ostream &out) { out << (*first + *second); };
+	}
+	if (op == "-")
+	{
+		return [first, second](std::ostream &out) { out << (*first - *second); };
+	}
+	return [first, second](std::ostream &out) { out << (*first * *second); };
+}
+
+template <typename T>
+std::shared_ptr<Matrix<T>> readBatchMatrix(std::istream &in, unsigned long &lineNumber)
+{
+	std::string line;
+	if (!readBatchLine(in, line, lineNumber))
+	{
+		throw std::runtime_error("missing operand");
+	}
+	std::istringstream dimensions(line);
+	long rows = 0, cols = 0;
+	if (!(dimensions >> rows >> cols) || !isBlank(dimensions) || rows <= 0 || cols <= 0)
+	{
+		throw std::runtime_error("expected the dimensions of a matrix");
+	}
+	if (rows > BATCH_MAX_CELLS / cols)
+	{
+		throw std::runtime_error("a matrix may have at most " +
+		                         std::to_string(BATCH_MAX_CELLS) + " cells");
+	}
+
+	std::vector<T> cells;
+	cells.reserve((size_t) (rows * cols));
+	for (long row = 0; row < rows; row++)
+	{
+		if (!readBatchLine(in, line, lineNumber))
+		{
+			throw std::runtime_error("missing row");
+		}
+		std::stringstream stream(line);
+		std::string numStr;
+		T val;
+		for (long col = 0; col < cols; col++)
+		{
+			if (!getline(stream, numStr, DELIM))
+			{
+				throw std::runtime_error("expected " + std::to_string(cols) + " cells");
+			}
+			if (!readBatchCell(numStr, &val))
+			{
+				throw std::runtime_error("invalid cell '" + numStr + "'");
+			}
+			cells.push_back(val);
+		}
+		// Only the delimiter of the last cell may follow it
+		if (!isBlank(stream))
+		{
+			throw std::runtime_error("expected " + std::to_string(cols) + " cells");
+		}
+	}
+	return std::make_shared<Matrix<T>>((unsigned int) rows, (unsigned int) cols, cells);
+}
+
+// Reads a whole cell, so a malformed cell (e.g. "x" or "1x") is an error instead of 0
+template <typename T>
+bool readBatchCell(const std::string &str, T *num)
+{
+	std::istringstream stream(str);
+	return (stream >> *num) && isBlank(stream);
+}
+
+// A complex cell is its real part, optionally followed by its imaginary part
+bool readBatchCell(const std::string &str, Complex *num)
+{
+	std::istringstream stream(str);
+	double r = 0, i = 0;
+	if (!(stream >> r) || (!isBlank(stream) && !(stream >> i)) || !isBlank(stream))
+	{
+		return false;
+	}
+	*num = Complex(r, i);
+	return true;
+}
+
+// Checks that only white space is left in the stream, without reading anything else
+bool isBlank(std::istream &stream)
+{
+	stream >> std::ws;
+	return stream.eof();
+}
+
+bool readBatchLine(std::istream &in, std::string &line, unsigned long &lineNumber)
+{
+	while (getline(in, line))
+	{
+		lineNumber++;
+		size_t start = line.find_first_not_of(" \t\r");
+		if (start != std::string::npos && line[start] != BATCH_COMMENT)
+		{
+			return true;
+		}
+	}
+	return false;
+}
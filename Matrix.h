@@ -31,7 +31,159 @@
 
 #include <iostream>
 #include <vector>
+#include <initializer_list>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <complex>
+#include <functional>
 #include "MatrixException.h"
+#include "MatrixTopology.h"
+#include "MatrixStorage.h"
+#include "ScalarTraits.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def APPROX_RELATIVE_TOLERANCE 1e-9
+ * @brief A Macro that sets the default relative tolerance of an approximate comparison.
+ */
+#define APPROX_RELATIVE_TOLERANCE 1e-9
+
+/**
+ * @def APPROX_ABSOLUTE_TOLERANCE 0.0
+ * @brief A Macro that sets the default absolute tolerance of an approximate comparison.
+ */
+#define APPROX_ABSOLUTE_TOLERANCE 0.0
+
+
+/*-----=  Forward Declarations  =-----*/
+
+
+template <class T>
+class LUDecomposition;
+
+template <class T>
+class CholeskyDecomposition;
+
+template <class T>
+class QRDecomposition;
+
+template <class T>
+class TiledMatrix;
+
+template <class T>
+class MatrixFuture;
+
+template <class T>
+class MatrixProduct;
+
+template <class T>
+class MatrixCache;
+
+template <class T>
+class StructuredMatrix;
+
+class Complex;
+
+
+/*-----=  Enums Definition  =-----*/
+
+
+/**
+ * @brief The order of the cells of a Matrix in the memory.
+ */
+enum MatrixLayout
+{
+    /**
+     * @brief The rows are stored one after the other.
+     */
+    ROW_MAJOR,
+
+    /**
+     * @brief The columns are stored one after the other.
+     */
+    COLUMN_MAJOR
+};
+
+/**
+ * @brief The operations whose results are kept by the Matrix Cache.
+ */
+enum MatrixCacheOperation
+{
+    CACHED_ADDITION,
+    CACHED_SUBTRACTION,
+    CACHED_MULTIPLICATION,
+
+    /**
+     * @brief A multiplication of Matrices of double in float precision.
+     */
+    CACHED_MIXED_MULTIPLICATION,
+
+    /**
+     * @brief A multiplication of Matrices of Complex numbers by three real products.
+     */
+    CACHED_GAUSS_MULTIPLICATION
+};
+
+
+/*-----=  Structs Definition  =-----*/
+
+
+/**
+ * @brief The estimated cost of a chain of multiplications, in floating point operations
+ *        (a multiplication and an addition for every scalar product).
+ */
+struct MatrixChainCost
+{
+    /**
+     * @brief The cost of multiplying the chain from left to right.
+     */
+    double naiveFlops;
+
+    /**
+     * @brief The cost of multiplying the chain in the optimal order.
+     */
+    double optimalFlops;
+};
+
+/**
+ * @brief A description of the memory of a Matrix, which is used to adopt memory of the user
+ *        into a Matrix and to export the memory of a Matrix, without copying the cells.
+ *        Cell (i, j) is at data[i * stride + j] in ROW_MAJOR layout, and at
+ *        data[i + j * stride] in COLUMN_MAJOR layout.
+ */
+template <class T>
+struct MatrixBuffer
+{
+    /**
+     * @brief The first cell.
+     */
+    T *data;
+
+    /**
+     * @brief The number of rows.
+     */
+    unsigned int rows;
+
+    /**
+     * @brief The number of columns.
+     */
+    unsigned int cols;
+
+    /**
+     * @brief The distance between two consecutive rows (in ROW_MAJOR layout) or columns (in
+     *        COLUMN_MAJOR layout), i.e. the leading dimension of the memory.
+     */
+    unsigned int stride;
+
+    /**
+     * @brief The order of the cells in the memory.
+     */
+    MatrixLayout layout;
+};
 
 
 /*-----=  Class Definition  =-----*/
@@ -64,8 +216,21 @@ public:
      */
     Matrix(unsigned int rows, unsigned int cols);
 
+    /**
+     * @brief A Constructor for a Matrix which receives the desired dimensions and the order of
+     *        the cells in the memory, and all the elements in the Matrix are set to
+     *        DEFAULT_VALUE. The operators work on both layouts, with kernels which read the
+     *        cells in the order of each layout.
+     *        If one of the dimensions is invalid (i.e. equals to zero), an Exception will be thrown
+     * @param rows The number of rows in the Matrix.
+     * @param cols The number of columns in the Matrix.
+     * @param layout The order of the cells in the memory.
+     */
+    Matrix(unsigned int rows, unsigned int cols, MatrixLayout layout);
+
     /**
      * @brief A Copy Constructor for a Matrix which receives another Matrix and create a copy of it.
+     *        In Copy On Write mode the copy shares the cells until one of the Matrices is changed.
      * @param other The Matrix to copy.
      */
     Matrix(const Matrix<T>& other);
@@ -88,6 +253,19 @@ public:
      */
     Matrix(unsigned int rows, unsigned int cols, const std::vector<T>& cells);
 
+    /**
+     * @brief A Constructor for a Matrix which adopts the given memory of the user without
+     *        copying it. The Matrix reads and writes the cells in place, so the memory must stay
+     *        valid while the Matrix uses it. Copies of the Matrix (and results of operations)
+     *        are independent Matrices which own their cells. A change of the memory which is
+     *        not made through the Matrix must be followed by a call to buffer(), so the cached
+     *        checksum of the Matrix is forgotten.
+     *        If one of the dimensions is invalid, if the memory is null or if the stride is
+     *        smaller than the rows (or columns) of the layout, an Exception will be thrown.
+     * @param buffer The memory to adopt.
+     */
+    explicit Matrix(const MatrixBuffer<T>& buffer);
+
     /**
      * @brief The Destructor for the Matrix.
      */
@@ -111,7 +289,7 @@ public:
      *        If the dimensions of this Matrix doesn't fit the given Matrix, an Exception will
      *        be thrown.
      *        This operator supports multithread mode, where each thread perform the operation
-     *        of a single row in the Matrix.
+     *        of a tile of rows and columns in the Matrix.
      * @param other The other Matrix to add to this Matrix.
      * @return A Matrix which represent the result of the addition operation.
      */
@@ -137,7 +315,12 @@ public:
      *        If the dimensions of this Matrix doesn't fit the given Matrix, an Exception will
      *        be thrown.
      *        This operator supports multithread mode, where each thread perform the operation
-     *        of a single row in the Matrix.
+     *        of a tile of rows and columns in the Matrix.
+     *        A Matrix of int is multiplied with 64 bits accumulators, and if a cell of the
+     *        result doesn't fit an int (or one of it's sums doesn't fit 64 bits), an Exception
+     *        will be thrown.
+     *        A Matrix of double is multiplied in float precision if the Mixed Precision Flag
+     *        is on.
      * @param other The other Matrix to multiply to this Matrix.
      * @return A Matrix which represent the result of the multiplication operation.
      */
@@ -161,13 +344,182 @@ public:
      */
     bool operator!=(const Matrix<T>& other) const;
 
+    /**
+     * @brief Determine if this Matrix is approximately equal to the given other Matrix, i.e.
+     *        for each cell |a - b| <= atol + rtol * |b|, where b is the cell of the other
+     *        Matrix. The cells are compared in blocks without branches, so the comparison
+     *        vectorizes, and it stops after the first block with a different cell.
+     * @param other The other Matrix to check.
+     * @param rtol The relative tolerance.
+     * @param atol The absolute tolerance.
+     * @return true if the Matrices have the same dimensions and all their cells are
+     *         approximately equal, false otherwise.
+     */
+    bool approxEqual(const Matrix<T>& other, double rtol = APPROX_RELATIVE_TOLERANCE,
+                     double atol = APPROX_ABSOLUTE_TOLERANCE) const;
+
+    /**
+     * @brief Returns a checksum of the dimensions and the content of this Matrix.
+     *        The checksum is computed once and cached until the Matrix is changed (any access
+     *        through the non-const operator(), buffer() or an assignment), so equal Matrices
+     *        always have the same checksum, and Matrices with different checksums are different.
+     *        A change through a reference or memory which was taken before the checksum was
+     *        cached is not seen by it (see buffer()).
+     *        Only a Matrix of hashable elements (see ScalarTraits) has a checksum.
+     * @return The checksum of this Matrix.
+     */
+    std::uint64_t checksum() const;
+
     /**
      * @brief Perform the Transpose operation on this Matrix.
      *        This operator does not change this Matrix data.
+     *        The Transpose is a copy of the cells of this Matrix in the opposite layout (so they
+     *        are copied as they are stored, without reordering them). In Copy On Write mode it
+     *        shares the cells instead, so it takes constant time, unless references to them
+     *        were given out (by the non-const operator() or buffer()). A Matrix of Complex
+     *        numbers is conjugated, so it's cells are always copied.
      * @return A Matrix which represent the result of the Transpose operation.
      */
     Matrix<T> trans() const;
 
+    /**
+     * @brief An operator overload for the multiplication operator '*' with a scalar.
+     *        The operator multiply each cell of this Matrix with the given scalar and return a
+     *        new Matrix which represent the result of the multiplication operation.
+     *        This operator does not change this Matrix data.
+     *        This operator supports multithread mode, where each thread perform the operation
+     *        on a contiguous block of cells in the Matrix.
+     * @param scalar The scalar to multiply this Matrix with.
+     * @return A Matrix which represent the result of the multiplication operation.
+     */
+    Matrix<T> operator*(const T& scalar) const;
+
+    /**
+     * @brief Perform the Hadamard (element-wise) product of this Matrix with the given Matrix.
+     *        This operator does not change this Matrix or the given Matrix data.
+     *        If the dimensions of this Matrix doesn't fit the given Matrix, an Exception will
+     *        be thrown.
+     *        This operator supports multithread mode, where each thread perform the operation
+     *        on a contiguous block of rows (or columns) in the Matrix.
+     * @param other The other Matrix to multiply element-wise with this Matrix.
+     * @return A Matrix which represent the result of the Hadamard product.
+     */
+    Matrix<T> hadamard(const Matrix<T>& other) const;
+
+    /**
+     * @brief Returns the sum of all the cells in the Matrix.
+     *        For an empty Matrix the result is DEFAULT_VALUE.
+     * @return The sum of all the cells in the Matrix.
+     */
+    T sum() const;
+
+    /**
+     * @brief Returns the Frobenius Norm of the Matrix, i.e. the square root of the sum of the
+     *        squared magnitudes of all the cells in the Matrix.
+     * @return The Frobenius Norm of the Matrix.
+     */
+    double frobeniusNorm() const;
+
+    /**
+     * @brief Returns the largest magnitude of a cell in the Matrix.
+     *        For an empty Matrix the result is zero.
+     * @return The largest magnitude of a cell in the Matrix.
+     */
+    double maxAbs() const;
+
+    /**
+     * @brief Apply the given function on each cell of this Matrix and return a new Matrix which
+     *        holds the results.
+     *        This operator does not change this Matrix data.
+     *        In multithread mode the function is called concurrently from several threads, so it
+     *        must be safe to do so.
+     * @param function The function to apply, which receives a cell and returns the new cell.
+     * @return A Matrix which holds the result of the function on each cell.
+     */
+    template <class Function>
+    Matrix<T> map(Function function) const;
+
+    /**
+     * @brief Reduce all the cells in the Matrix into a single value using the given operation.
+     *        The operation must be associative, because the cells are reduced in blocks which are
+     *        combined in a tree order. The given initial value is combined with the result once.
+     *        In deterministic mode the reduction order depends only on the Matrix dimensions, so
+     *        the result is the same in parallel and non-parallel mode.
+     * @param init The initial value of the reduction.
+     * @param operation The binary associative operation to reduce the cells with.
+     * @return The reduction of all the cells in the Matrix.
+     */
+    template <class BinaryOperation>
+    T reduce(const T& init, BinaryOperation operation) const;
+
+    /**
+     * @brief Returns the determinant of this Matrix, computed from it's LU Decomposition.
+     *        Only a Matrix of floating point (or Complex) elements has a determinant.
+     *        If this Matrix is not a square Matrix, an Exception will be thrown.
+     * @return The determinant of this Matrix.
+     */
+    template <class U = T>
+    FloatingResult<U, T> det() const;
+
+    /**
+     * @brief Solve the linear system (this * X = b) using the LU Decomposition of this Matrix.
+     *        The given Matrix may have several columns, and each of them is solved separately.
+     *        If this Matrix is not a square Matrix or if it doesn't fit the given Matrix, an
+     *        Exception will be thrown. If this Matrix is singular an Exception will be thrown.
+     * @param b The right hand side of the linear system.
+     * @return The Matrix X which solves the linear system.
+     */
+    template <class U = T>
+    FloatingResult<U, Matrix<T>> solve(const Matrix<T>& b) const;
+
+    /**
+     * @brief Returns the inverse of this Matrix, computed from it's LU Decomposition.
+     *        If this Matrix is not a square Matrix or if it is singular, an Exception will
+     *        be thrown.
+     * @return The inverse of this Matrix.
+     */
+    template <class U = T>
+    FloatingResult<U, Matrix<T>> inverse() const;
+
+    /**
+     * @brief Returns the identity Matrix of the given size.
+     * @param size The number of rows and columns in the identity Matrix.
+     * @return The identity Matrix of the given size.
+     */
+    static Matrix<T> identity(unsigned int size);
+
+    /**
+     * @brief Returns a Future for the product of the given Matrices, which is computed by the
+     *        shared Matrix Thread Pool when both of them are ready, without blocking the caller.
+     *        A Matrix may be given instead of a Future. If the dimensions doesn't fit, the
+     *        Exception is thrown by get() of the result.
+     * @param first The first Matrix in the multiplication operation (on the left side).
+     * @param second The second Matrix in the multiplication operation (on the right side).
+     * @return A Future for the product.
+     */
+    static MatrixFuture<T> multiplyAsync(const MatrixFuture<T>& first,
+                                         const MatrixFuture<T>& second);
+
+    /**
+     * @brief Returns a Future for the sum of the given Matrices, which is computed by the
+     *        shared Matrix Thread Pool when both of them are ready, without blocking the caller.
+     *        A Matrix may be given instead of a Future. If the dimensions doesn't fit, the
+     *        Exception is thrown by get() of the result.
+     * @param first The first Matrix to add.
+     * @param second The second Matrix to add.
+     * @return A Future for the sum.
+     */
+    static MatrixFuture<T> addAsync(const MatrixFuture<T>& first, const MatrixFuture<T>& second);
+
+    /**
+     * @brief Returns a Future for the Transpose of the given Matrix, which is computed by the
+     *        shared Matrix Thread Pool when it is ready, without blocking the caller.
+     *        A Matrix may be given instead of a Future.
+     * @param matrix The Matrix to transpose.
+     * @return A Future for the Transpose.
+     */
+    static MatrixFuture<T> transAsync(const MatrixFuture<T>& matrix);
+
     /**
      * @brief An operator overload for the output stream operator '<<'.
      *        The operator creates an output format for a Matrix and sets the given output stream
@@ -200,7 +552,9 @@ public:
      *        The operator gives access to the element in the Matrix in the given row and column
      *        by calling the Matrix with the operator as - matrixName(row, col).
      *        This function returns a reference to the element in the requested cell, and
-     *        the user can read the data and also can change it.
+     *        the user can read the data and also can change it. Since the reference may be used
+     *        at any time, the cells of this Matrix are not shared with it's later copies or
+     *        Transposes (in Copy On Write mode they are copied instead).
      *        If one of the given indices to access are invalid, an Exception will be thrown.
      * @param rowNumber The row number in the Matrix to access.
      * @param colNumber The column number in the Matrix to access.
@@ -227,22 +581,87 @@ public:
     unsigned int cols() const { return _cols; };
 
     /**
-     * @brief const_iterator is a constant iterator for the type T Vector which contains
-     *        the Matrix data.
+     * @brief Returns a description of the memory of this Matrix, so it can be passed to other
+     *        libraries without copying. The cells may be changed through the returned memory
+     *        until the next use of the checksum of this Matrix (a comparison or the result
+     *        cache), which caches the content of that time. To change the cells after it,
+     *        call buffer() again, which forgets the cached checksum. Like the non-const
+     *        operator(), it stops the cells from being shared with later copies.
+     * @return The memory of this Matrix.
      */
-    typedef typename std::vector<T>::const_iterator const_iterator;
+    MatrixBuffer<T> buffer();
+
+    /**
+     * @brief Returns a read-only description of the memory of this Matrix.
+     * @return The memory of this Matrix.
+     */
+    MatrixBuffer<const T> buffer() const;
+
+    /**
+     * @brief Returns the order of the cells of this Matrix in the memory.
+     * @return The order of the cells of this Matrix in the memory.
+     */
+    MatrixLayout layout() const;
+
+    /**
+     * @brief Sets the tracking of the changes of this Matrix to be on or off by the given
+     *        parameter. While the changes are tracked, the rows and columns which are changed
+     *        through the non-const operator() are recorded (a cell which was only read through
+     *        it is recorded as well), and any other change of the cells (e.g. an assignment or
+     *        a change through buffer()) marks all of them. Turning the tracking on clears the
+     *        recorded changes. A copy of a Matrix doesn't track it's changes.
+     * @param trackingFlag The requested state of the tracking.
+     */
+    void setChangeTracking(const bool trackingFlag);
+
+    /**
+     * @brief Determine if the changes of this Matrix are tracked.
+     * @return true if the changes are tracked, false otherwise.
+     */
+    bool isTrackingChanges() const { return (bool) _changes; };
+
+    /**
+     * @brief Returns the rows which were changed since the changes were last cleared.
+     *        If the changes are not tracked, all the rows are returned.
+     * @return The changed rows, in increasing order.
+     */
+    std::vector<unsigned int> changedRows() const;
+
+    /**
+     * @brief Returns the columns which were changed since the changes were last cleared.
+     *        If the changes are not tracked, all the columns are returned.
+     * @return The changed columns, in increasing order.
+     */
+    std::vector<unsigned int> changedCols() const;
+
+    /**
+     * @brief Clear the recorded changes of this Matrix, if they are tracked.
+     */
+    void clearChanges();
+
+    /**
+     * @brief const_iterator is a constant iterator over the cells of the Matrix in row order.
+     */
+    typedef MatrixIterator<T> const_iterator;
 
     /**
      * @brief Returns the const iterator for the beginning of the Matrix.
      * @return const iterator for the beginning of the Matrix.
      */
-    const_iterator begin() const { return _cells.begin(); };
+    const_iterator begin() const
+    {
+        return const_iterator(_cells.data(), _cols, _rowStride, _colStride, 0);
+    };
 
     /**
      * @brief Returns the const iterator for the end of the Matrix.
      * @return const iterator for the end of the Matrix.
      */
-    const_iterator end() const { return _cells.end(); };
+    const_iterator end() const
+    {
+        return const_iterator(_cells.data(), _cols, _rowStride, _colStride,
+                              (std::size_t) _rows * _cols);
+    };
 
     /**
      * @brief Sets the Thread Flag to be on or off by the given parameter.
@@ -255,8 +674,164 @@ public:
      */
     static void setParallel(const bool threadFlag);
 
+    /**
+     * @brief Sets the Deterministic Flag to be on or off by the given parameter.
+     *        In deterministic mode all the reductions (e.g. sum, frobeniusNorm) split the cells
+     *        into fixed size blocks and combine them in a fixed tree order, so the result of a
+     *        floating point reduction does not depend on the thread mode or the number of cores.
+     * @param deterministicFlag The requested state of the Deterministic Flag.
+     */
+    static void setDeterministic(const bool deterministicFlag)
+    {
+        _deterministicFlag = deterministicFlag;
+    };
+
+    /**
+     * @brief Sets the Affinity Flag to be on or off by the given parameter.
+     *        When the flag is on, worker i of the parallel mode is pinned to core i of the
+     *        machine topology (the cores are ordered node after node), so each worker processes
+     *        and first touches it's block of rows on the same NUMA node.
+     * @param affinityFlag The requested state of the Affinity Flag.
+     */
+    static void setThreadAffinity(const bool affinityFlag) { _affinityFlag = affinityFlag; };
+
+    /**
+     * @brief Sets the number of worker threads of the parallel mode.
+     * @param workerCount The number of worker threads, or zero to use one worker per core.
+     */
+    static void setWorkerCount(const unsigned int workerCount) { _workerSetting = workerCount; };
+
+    /**
+     * @brief Sets the Mixed Precision Flag to be on or off by the given parameter.
+     *        When the flag is on, the multiplication of Matrices of double rounds each operand
+     *        to float once, and the products read the float copies (half of the bytes of the
+     *        operands, for half of their memory more) and accumulate in double. The products
+     *        are exact, so the error of a cell is bounded by about 2^-23 times the sum of the
+     *        absolute products of it's row and column. Other element types ignore it, and so
+     *        do the internal products of the decompositions and the Matrix functions.
+     * @param mixedPrecisionFlag The requested state of the Mixed Precision Flag.
+     */
+    static void setMixedPrecision(const bool mixedPrecisionFlag)
+    {
+        _mixedPrecisionFlag = mixedPrecisionFlag;
+    };
+
+    /**
+     * @brief Sets the Gauss Multiplication Flag to be on or off by the given parameter.
+     *        When the flag is on, the multiplication of Matrices of Complex numbers splits them
+     *        into their real and imaginary parts, and computes the product by three real
+     *        products instead of four (the 3M method): Ar * Br, Ai * Bi and
+     *        (Ar + Ai) * (Br + Bi), so it takes about 25% fewer operations. The imaginary part
+     *        is the difference of the third product and the first two, so it's error is bounded
+     *        by the magnitude of the products rather than of the result, which may be much
+     *        larger when they cancel. Other element types ignore it.
+     * @param gaussMultiplicationFlag The requested state of the Gauss Multiplication Flag.
+     */
+    static void setGaussMultiplication(const bool gaussMultiplicationFlag)
+    {
+        _gaussMultiplicationFlag = gaussMultiplicationFlag;
+    };
+
+    /**
+     * @brief Sets the Checksum Flag to be on or off by the given parameter.
+     *        When the flag is on, the comparison operators compute (and cache) the checksums of
+     *        the compared Matrices, so comparing an unchanged Matrix to a different Matrix again
+     *        takes constant time. When the flag is off, the checksums are used only if both
+     *        Matrices have one cached already. Matrices of elements which are compared with a
+     *        tolerance (e.g. Complex) are always compared cell by cell.
+     * @param checksumFlag The requested state of the Checksum Flag.
+     */
+    static void setChecksumCache(const bool checksumFlag) { _checksumFlag = checksumFlag; };
+
+    /**
+     * @brief Sets the Copy On Write Flag to be on or off by the given parameter.
+     *        When the flag is on, a copy of a Matrix (e.g. an argument passed by value or an
+     *        assignment) shares the cells of the copied Matrix, and the cells are duplicated
+     *        only when one of the Matrices is changed (through the non-const operator()). The
+     *        shared cells are counted atomically, so unchanged copies may be read from several
+     *        threads. Matrices which adopted memory of the user are always copied, and so are
+     *        Matrices which gave out references to their cells (by the non-const operator()
+     *        or buffer()), so a reference taken before a copy never changes the copy.
+     *        The first change of shared cells duplicates them, so it must not be made by
+     *        several threads at once (e.g. parallel writes through operator()): call buffer()
+     *        (or make one change) from a single thread before several threads change a
+     *        Matrix.
+     * @param copyOnWriteFlag The requested state of the Copy On Write Flag.
+     */
+    static void setCopyOnWrite(const bool copyOnWriteFlag) { _copyOnWriteFlag = copyOnWriteFlag; };
+
+    /**
+     * @brief Sets the Work Stealing Flag to be on or off by the given parameter.
+     *        When the flag is on, the parallel mode splits it's work recursively into blocks
+     *        which the workers steal from each other (see MatrixScheduler), so operations whose
+     *        rows don't cost the same (e.g. the triangular updates of the decompositions) keep
+     *        all the workers busy. The workers of the scheduler are not pinned to their cores,
+     *        since the blocks move between them.
+     * @param workStealingFlag The requested state of the Work Stealing Flag.
+     */
+    static void setWorkStealing(const bool workStealingFlag)
+    {
+        _workStealingFlag = workStealingFlag;
+    };
+
+    /**
+     * @brief Sets the Result Cache Flag to be on or off by the given parameter.
+     *        When the flag is on, the operators +, - and * remember their results in the shared
+     *        Matrix Cache, keyed by the checksums of their operands, so an operation which is
+     *        repeated on unchanged operands returns the remembered result (see MatrixCache).
+     *        The returned results share their cells with the remembered results until changed.
+     * @param resultCacheFlag The requested state of the Result Cache Flag.
+     */
+    static void setResultCache(const bool resultCacheFlag) { _resultCacheFlag = resultCacheFlag; };
+
 private:
 
+    /**
+     * @brief The decompositions work directly on the Matrix cells.
+     */
+    friend class LUDecomposition<T>;
+    friend class CholeskyDecomposition<T>;
+    friend class QRDecomposition<T>;
+
+    /**
+     * @brief The Tiled Matrix reads and writes the tiles directly into the Matrix cells.
+     */
+    friend class TiledMatrix<T>;
+
+    /**
+     * @brief The Matrix Product updates it's result directly in the Matrix cells.
+     */
+    friend class MatrixProduct<T>;
+
+    /**
+     * @brief The Matrix Future swaps the results of it's tasks in, without copying them.
+     */
+    friend class MatrixFuture<T>;
+
+    /**
+     * @brief The Matrix Cache shares the cells of it's results with the returned Matrices.
+     */
+    friend class MatrixCache<T>;
+
+    /**
+     * @brief The Structured Matrix reads and writes the dense Matrices of it's operations
+     *        directly in the Matrix cells.
+     */
+    friend class StructuredMatrix<T>;
+
+    /**
+     * @brief The Matrix functions reuse their buffers through the private multiplication.
+     */
+    template <class U>
+    friend Matrix<U> pow(const Matrix<U>& matrix, unsigned int exponent);
+
+    template <class U>
+    friend FloatingResult<U, Matrix<U>> matrixExp(const Matrix<U>& matrix);
+
+    template <class U>
+    friend Matrix<U> multiplyChain(const std::vector<const Matrix<U>*>& factors,
+                                   MatrixChainCost *cost);
+
     /**
      * @brief The number of rows in the Matrix.
      */
@@ -269,8 +844,36 @@ private:
 
     /**
      * @brief The cells in the Matrix which holds the data.
+     *        Cell (i, j) is at _cells[i * _rowStride + j * _colStride].
      */
-    std::vector<T> _cells;
+    MatrixStorage<T> _cells;
+
+    /**
+     * @brief The distance between two consecutive rows in the cells.
+     */
+    unsigned int _rowStride;
+
+    /**
+     * @brief The distance between two consecutive columns in the cells.
+     */
+    unsigned int _colStride;
+
+    /**
+     * @brief The cached checksum of the Matrix, which is valid only if the Checksum Valid flag
+     *        is on. Both are atomic, so the checksum may be computed from concurrent readers.
+     */
+    mutable std::atomic<std::uint64_t> _checksum;
+
+    /**
+     * @brief A flag which determine if the cached checksum is valid.
+     */
+    mutable std::atomic<bool> _checksumValid;
+
+    /**
+     * @brief The changes of the Matrix since they were last cleared, or null if the changes
+     *        are not tracked.
+     */
+    std::unique_ptr<MatrixChanges> _changes;
 
     /**
      * @brief A flag which determine if the operation that support multi-threading should
@@ -279,15 +882,306 @@ private:
     static bool _threadFlag;
 
     /**
-     * @brief An Helper Function for the Plus Operator.
-     *        While working on multithread mode, this function is called from a single
-     *        thread in order to perform the addition operation on a single row.
-     *        Note: I had to change the name from 's_plusHelper' because of the bug in the script.
-     * @param result The Matrix in which we perform the addition operation.
-     * @param other The Matrix which contains the data to add.
-     * @param rowNumber The current row number in the Matrices to perform the operation.
+     * @brief A flag which determine if the reductions should use a fixed reduction order.
+     */
+    static bool _deterministicFlag;
+
+    /**
+     * @brief A flag which determine if the worker threads should be pinned to their cores.
+     */
+    static bool _affinityFlag;
+
+    /**
+     * @brief The requested number of worker threads (zero for one worker per core).
+     */
+    static unsigned int _workerSetting;
+
+    /**
+     * @brief A flag which determine if Matrices of double are multiplied in float precision.
+     */
+    static bool _mixedPrecisionFlag;
+
+    /**
+     * @brief A flag which determine if Matrices of Complex numbers are multiplied by three
+     *        real products.
+     */
+    static bool _gaussMultiplicationFlag;
+
+    /**
+     * @brief A flag which determine if the comparison operators compute the checksums.
+     */
+    static bool _checksumFlag;
+
+    /**
+     * @brief A flag which determine if copies of a Matrix share it's cells until changed.
+     */
+    static bool _copyOnWriteFlag;
+
+    /**
+     * @brief A flag which determine if the parallel mode is scheduled by work stealing.
+     */
+    static bool _workStealingFlag;
+
+    /**
+     * @brief A flag which determine if the operators remember their results in the cache.
+     */
+    static bool _resultCacheFlag;
+
+    /**
+     * @brief Mark the cached checksum of this Matrix as invalid, which must be done whenever
+     *        the cells are changed. If the changes are tracked, all the cells are marked as
+     *        changed.
+     */
+    void _invalidateChecksum()
+    {
+        _checksumValid.store(false, std::memory_order_release);
+        if (_changes)
+        {
+            _changes -> markAll();
+        }
+    };
+
+    /**
+     * @brief Mark the cached checksum of this Matrix as invalid, when only the cell in the
+     *        given row and column may be changed. If the changes are tracked, the cell is
+     *        marked as changed.
+     * @param row The row of the cell.
+     * @param col The column of the cell.
+     */
+    void _invalidateChecksum(unsigned int row, unsigned int col)
+    {
+        _checksumValid.store(false, std::memory_order_release);
+        if (_changes)
+        {
+            _changes -> mark(row, col);
+        }
+    };
+
+    /**
+     * @brief Determine if the cells of this Matrix are packed in row order, which is the
+     *        layout that the kernels and the friends of the Matrix work on directly.
+     * @return true if the cells are packed in row order, false otherwise.
+     */
+    bool _isPacked() const { return _colStride == 1 && _rowStride == _cols; };
+
+    /**
+     * @brief Returns the given Matrix if it's cells are packed in row order, otherwise packs a
+     *        copy of it into the given scratch Matrix and returns the scratch Matrix.
+     * @param matrix The Matrix to read.
+     * @param scratch The Matrix which holds the packed copy, if one is needed.
+     * @return A Matrix with the cells of the given Matrix, packed in row order.
+     */
+    static const Matrix<T>& _packed(const Matrix<T>& matrix,
+                                    std::unique_ptr<Matrix<T>>& scratch);
+
+    /**
+     * @brief Copy the cells of the given Matrix, which are packed in row order, into the cells
+     *        of this Matrix (in it's own layout), so the friends can work in place on a packed
+     *        copy of an adopted Matrix.
+     * @param packed The Matrix with the same dimensions to copy the cells from.
+     */
+    void _unpack(const Matrix<T>& packed);
+
+    /**
+     * @brief Determine if the cells of this Matrix are contiguous, in row or in column order.
+     * @return true if the cells are contiguous, false otherwise.
+     */
+    bool _isDense() const
+    {
+        return (_colStride == 1 && _rowStride == _cols) || (_rowStride == 1 && _colStride == _rows);
+    };
+
+    /**
+     * @brief Determine if the given Matrices are dense and in the same layout, so their cells
+     *        in the same position are also in the same position in their storage.
+     * @param first The first Matrix.
+     * @param second The second Matrix, with the same dimensions.
+     * @return true if the Matrices have the same dense layout, false otherwise.
+     */
+    static bool _sameLayout(const Matrix<T>& first, const Matrix<T>& second)
+    {
+        return first._isDense() && second._isDense() && first.layout() == second.layout();
+    };
+
+    /**
+     * @brief Determine if the checksums of the given Matrices show that they are different.
+     *        The checksums are compared only if the Checksum Flag is on or if both are cached.
+     *        Different checksums mean different cells (equal cells always have equal checksums).
+     * @param first The first Matrix.
+     * @param second The second Matrix, with the same dimensions.
+     * @return true if the Matrices are different, false if they should be compared cell by cell.
+     */
+    static bool _differentChecksums(const Matrix<T>& first, const Matrix<T>& second,
+                                    std::true_type)
+    {
+        return (_checksumFlag || (first._checksumValid.load(std::memory_order_acquire) &&
+                                  second._checksumValid.load(std::memory_order_acquire))) &&
+               first.checksum() != second.checksum();
+    };
+
+    /**
+     * @brief An element type without an exact equality or without a hash has no checksums
+     *        to compare, so the Matrices are always compared cell by cell.
+     * @return false.
+     */
+    static bool _differentChecksums(const Matrix<T>&, const Matrix<T>&, std::false_type)
+    {
+        return false;
+    };
+
+    /**
+     * @brief Gives access to the cell in the given row and column, without checking the indices.
+     * @param row The row of the cell.
+     * @param col The column of the cell.
+     * @return Access to the cell.
+     */
+    T& _cell(unsigned int row, unsigned int col)
+    {
+        return _cells[((std::size_t) row * _rowStride) + ((std::size_t) col * _colStride)];
+    };
+
+    /**
+     * @brief Gives read-only access to the cell in the given row and column, without checking
+     *        the indices.
+     * @param row The row of the cell.
+     * @param col The column of the cell.
+     * @return A read-only access to the cell.
+     */
+    const T& _cell(unsigned int row, unsigned int col) const
+    {
+        return _cells[((std::size_t) row * _rowStride) + ((std::size_t) col * _colStride)];
+    };
+
+    /**
+     * @brief Duplicate the cells of this Matrix if they are shared with another Matrix (e.g. a
+     *        Transpose or a copy in Copy On Write mode), which must be done before the cells
+     *        are changed. It is done before a reference to the cells is given out, which also
+     *        exposes them, so the cells are never shared while a reference to them exists.
+     */
+    void _detach()
+    {
+        if (_cells.isShared())
+        {
+            _cells = _cells.clone();
+        }
+    };
+
+    /**
+     * @brief Sets the given view to the Transpose of the given Matrix, sharing it's cells in the
+     *        opposite layout.
+     * @param matrix The Matrix to transpose.
+     * @param view The Matrix which is set to the transposed view.
+     * @param borrow If true, the view only refers to the cells (like adopted memory), so a
+     *        short lived view may be written without duplicating the cells.
+     */
+    static void _transposeView(const Matrix<T>& matrix, Matrix<T>& view, bool borrow = false);
+
+    /**
+     * @brief Sets the given view to the given Matrix, sharing it's cells and it's checksum.
+     * @param matrix The Matrix to share.
+     * @param view The Matrix which is set to the shared view.
+     */
+    static void _share(const Matrix<T>& matrix, Matrix<T>& view);
+
+    /**
+     * @brief Returns the number of worker threads to use in parallel mode.
+     * @return The number of worker threads.
+     */
+    static unsigned int _workerCount();
+
+    /**
+     * @brief Perform the given task on the range [0, count).
+     *        In parallel mode the range is split into contiguous blocks, and each block is
+     *        performed by a separate thread (pinned to it's core if the Affinity Flag is on).
+     *        In non-parallel mode the whole range is performed by the calling thread.
+     * @param count The size of the range.
+     * @param task The task to perform, which receives the beginning and the end of a block.
+     */
+    template <class Function>
+    static void _parallelFor(unsigned int count, Function task);
+
+    /**
+     * @brief Perform the given task on the grid [0, rows) x [0, cols).
+     *        In parallel mode the grid is split into at most one tile per worker: the rows are
+     *        split into contiguous blocks as in _parallelFor, and if there are fewer rows than
+     *        workers, each block of rows is also split into blocks of columns.
+     * @param rows The number of rows in the grid.
+     * @param cols The number of columns in the grid.
+     * @param task The task to perform, which receives the beginning and the end of the rows
+     *        and of the columns of a tile.
+     */
+    template <class Function>
+    static void _parallelGrid(unsigned int rows, unsigned int cols, Function task);
+
+    /**
+     * @brief Returns the beginning of the given block, when a range is split into the given
+     *        number of blocks which differ in size by at most one.
+     * @param count The size of the range.
+     * @param blocks The number of blocks.
+     * @param block The block, or the number of blocks for the end of the range.
+     * @return The beginning of the block.
+     */
+    static unsigned int _blockBegin(unsigned int count, unsigned int blocks, unsigned int block);
+
+    /**
+     * @brief An Helper Function for the reductions.
+     *        Reduce a non-empty range of cells into a single value, using several independent
+     *        accumulators so the compiler can vectorize the loop.
+     * @param first A pointer (or a Matrix Iterator) to the first cell in the range.
+     * @param count The number of cells in the range (must be positive).
+     * @param transform The function which transforms a cell before the reduction.
+     * @param operation The binary associative operation to reduce the cells with.
+     * @return The reduction of the range.
+     */
+    template <class R, class Iterator, class Transform, class BinaryOperation>
+    static R _reduceRange(Iterator first, unsigned int count, Transform transform,
+                          BinaryOperation operation);
+
+    /**
+     * @brief Transform each cell in the Matrix and reduce the results into a single value.
+     *        The cells are reduced in blocks (in parallel mode, each block by a separate thread),
+     *        and the results of the blocks are combined in a tree order.
+     * @param init The initial value of the reduction.
+     * @param transform The function which transforms a cell before the reduction.
+     * @param operation The binary associative operation to reduce the cells with.
+     * @param commutative Whether the operation is commutative, so the cells of a dense Matrix
+     *                    may be reduced in the order of their storage.
+     * @return The reduction of all the cells in the Matrix.
+     */
+    template <class R, class Transform, class BinaryOperation>
+    R _transformReduce(const R& init, Transform transform, BinaryOperation operation,
+                       bool commutative) const;
+
+    /**
+     * @brief An Helper Function for the element-wise operators.
+     *        Combine each cell of the first Matrix with the cell of the second Matrix in the same
+     *        position, using the given operation.
+     *        Matrices in the same dense layout are combined in their storage order, and the
+     *        result gets their layout. Otherwise the result is in row order, and the cells are
+     *        combined in tiles of columns.
+     * @param first The first Matrix in the operation.
+     * @param second The second Matrix in the operation, with the same dimensions.
+     * @param operation The operation, which receives the two cells and returns the result cell.
+     * @return A Matrix which holds the result of the operation on each cell.
      */
-    static void _plusHelper(Matrix<T>& result, const Matrix<T>& other, unsigned int rowNumber);
+    template <class Operation>
+    static Matrix<T> _elementwise(const Matrix<T>& first, const Matrix<T>& second,
+                                  Operation operation);
+
+    /**
+     * @brief An Helper Function for the element-wise operators which have a kernel.
+     *        Like the other _elementwise, but Matrices in the same dense layout are combined
+     *        by the given kernel, on a run of contiguous cells at once.
+     * @param first The first Matrix in the operation.
+     * @param second The second Matrix in the operation, with the same dimensions.
+     * @param operation The operation, which receives the two cells and returns the result cell.
+     * @param kernel The kernel, which receives the two runs of cells, the run of the result
+     *        cells and the number of cells, and performs the operation on each cell.
+     * @return A Matrix which holds the result of the operation on each cell.
+     */
+    template <class Operation, class Kernel>
+    static Matrix<T> _elementwise(const Matrix<T>& first, const Matrix<T>& second,
+                                  Operation operation, Kernel kernel);
 
     /**
      * @brief An Helper Function for the Multiply Operator.
@@ -299,9 +1193,138 @@ private:
      * @param first The first Matrix in the multiplication operation (on the right side).
      * @param second The second Matrix in the multiplication operation (on the left side).
      * @param rowNumber The current row number in the result Matrix to perform the operation.
+     * @param colBegin The first column of the row to compute.
+     * @param colEnd The end of the columns of the row to compute.
      */
     static void _multiHelper(Matrix<T>& result, const Matrix<T>& first, const Matrix<T>& second,
-                             unsigned int rowNumber);
+                             unsigned int rowNumber, unsigned int colBegin, unsigned int colEnd);
+
+    /**
+     * @brief An Helper Function for the Multiply Operator.
+     *        This function perform the multiplication operation for a single row, by adding each
+     *        row of the second Matrix, scaled by the matching cell of the first Matrix, to the
+     *        row of the result.
+     * @param result The Matrix in which we perform the multiplication operation.
+     * @param first The first Matrix in the multiplication operation (on the left side).
+     * @param second The second Matrix in the multiplication operation (on the right side).
+     * @param rowNumber The current row number in the result Matrix to perform the operation.
+     * @param colBegin The first column of the row to compute.
+     * @param colEnd The end of the columns of the row to compute.
+     */
+    static void _multiRowHelper(Matrix<T>& result, const Matrix<T>& first,
+                                const Matrix<T>& second, unsigned int rowNumber,
+                                unsigned int colBegin, unsigned int colEnd);
+
+    /**
+     * @brief Perform the multiplication operation of the given Matrices into the given result
+     *        Matrix in row order, with the row kernel which fits the layout of the second
+     *        Matrix.
+     * @param result The Matrix which holds the result of the multiplication operation.
+     * @param first The first Matrix in the multiplication operation (on the left side).
+     * @param second The second Matrix in the multiplication operation (on the right side).
+     */
+    static void _multiplyRows(Matrix<T>& result, const Matrix<T>& first,
+                              const Matrix<T>& second);
+
+    /**
+     * @brief Returns the number of slices of the inner dimension in which a product of the
+     *        given dimensions is computed, so a product with fewer cells than workers keeps
+     *        all the workers busy.
+     * @param rows The number of rows in the result Matrix.
+     * @param cols The number of columns in the result Matrix.
+     * @param inner The number of columns in the first Matrix.
+     * @return The number of slices, or 1 if the inner dimension is not split.
+     */
+    static unsigned int _innerSlices(unsigned int rows, unsigned int cols, unsigned int inner);
+
+    /**
+     * @brief Perform the multiplication operation of the given Matrices into the given result
+     *        Matrix by splitting the inner dimension into the given number of slices. Each
+     *        slice is multiplied by a separate worker into partial sums, which are then added
+     *        in a fixed order.
+     * @param result The Matrix which holds the result of the multiplication operation.
+     * @param first The first Matrix in the multiplication operation (on the left side).
+     * @param second The second Matrix in the multiplication operation (on the right side).
+     * @param slices The number of slices of the inner dimension.
+     */
+    static void _multiplySlices(Matrix<T>& result, const Matrix<T>& first,
+                                const Matrix<T>& second, unsigned int slices);
+
+    /**
+     * @brief Add the partial sums of the slices of a split product pairwise, in a fixed tree
+     *        order, into the partial sums of the first slice.
+     * @param partials The partial sums, 'cells' consecutive sums for each slice.
+     * @param slices The number of slices.
+     * @param cells The number of cells in the product.
+     */
+    template <class R>
+    static void _combineSlices(std::vector<R>& partials, unsigned int slices, std::size_t cells);
+
+    /**
+     * @brief If the given result Matrix is in column order, perform the multiplication
+     *        operation as the product of the transposed operands into the transposed result.
+     * @param result The Matrix which holds the result of the multiplication operation.
+     * @param first The first Matrix in the multiplication operation (on the left side).
+     * @param second The second Matrix in the multiplication operation (on the right side).
+     * @param exact Whether the product ignores the Mixed Precision and the Gauss
+     *              Multiplication Flags (see _multiply).
+     * @return true if the multiplication operation was performed, false otherwise.
+     */
+    static bool _multiplyTransposed(Matrix<T>& result, const Matrix<T>& first,
+                                    const Matrix<T>& second, bool exact);
+
+    /**
+     * @brief Pack the real parts, the imaginary parts and the sums of both of the given block
+     *        of cells of the given Matrix into three consecutive blocks of double in row order,
+     *        for the product of Complex Matrices by three real products. It is defined only for
+     *        Complex elements.
+     * @param matrix The Matrix to pack.
+     * @param rowBegin The first row of the block.
+     * @param rowEnd The end of the rows of the block.
+     * @param colBegin The first column of the block.
+     * @param colEnd The end of the columns of the block.
+     * @param parts The packed parts.
+     */
+    static void _packParts(const Matrix<T>& matrix, unsigned int rowBegin, unsigned int rowEnd,
+                           unsigned int colBegin, unsigned int colEnd, std::vector<double>& parts);
+
+    /**
+     * @brief Round the cells of the given Matrix to float, in row order, for the product of
+     *        Matrices of double in float precision. It is defined only for double elements.
+     * @param matrix The Matrix to pack.
+     * @param cells The packed cells.
+     */
+    static void _packFloats(const Matrix<T>& matrix, std::vector<float>& cells);
+
+    /**
+     * @brief Perform the multiplication operation of the given Matrices into the given result
+     *        Matrix, without allocating a new Matrix.
+     *        The result Matrix must already have the dimensions of the product, and it must not
+     *        be one of the multiplied Matrices.
+     *        This function supports multithread mode, where each thread perform the operation
+     *        of a tile of rows and columns in the Matrix.
+     * @param result The Matrix which holds the result of the multiplication operation.
+     * @param first The first Matrix in the multiplication operation (on the left side).
+     * @param second The second Matrix in the multiplication operation (on the right side).
+     * @param exact Whether the product ignores the Mixed Precision and the Gauss
+     *              Multiplication Flags, as the internal products of the decompositions and
+     *              the Matrix functions do.
+     */
+    static void _multiply(Matrix<T>& result, const Matrix<T>& first, const Matrix<T>& second,
+                          bool exact = false);
+
+    /**
+     * @brief Returns the product of the given Matrices, in column order if both of them are.
+     *        It doesn't check the dimensions of the Matrices, and it doesn't use the result
+     *        cache.
+     * @param first The first Matrix in the multiplication operation (on the left side).
+     * @param second The second Matrix in the multiplication operation (on the right side).
+     * @param exact Whether the product ignores the Mixed Precision and the Gauss
+     *              Multiplication Flags (see _multiply).
+     * @return A Matrix which represent the result of the multiplication operation.
+     */
+    static Matrix<T> _product(const Matrix<T>& first, const Matrix<T>& second,
+                              bool exact = false);
 
     /**
      * @brief Swaps the data between two given Matrices.
@@ -313,6 +1336,119 @@ private:
 };
 
 
+/*-----=  Non-Member Operators  =-----*/
+
+
+/**
+ * @brief An operator overload for the multiplication operator '*' of a scalar with a Matrix.
+ *        The operator multiply each cell of the given Matrix with the given scalar.
+ * @param scalar The scalar to multiply the Matrix with.
+ * @param matrix The Matrix to multiply.
+ * @return A Matrix which represent the result of the multiplication operation.
+ */
+template <class T>
+Matrix<T> operator*(const T& scalar, const Matrix<T>& matrix);
+
+/**
+ * @brief Raise the given square Matrix to the given power, using exponentiation by squaring.
+ *        The products are computed into two scratch buffers which are reused between the steps,
+ *        so only a constant number of Matrices is allocated regardless of the exponent.
+ *        If the given Matrix is not a square Matrix, an Exception will be thrown.
+ * @param matrix The Matrix to raise.
+ * @param exponent The power to raise the Matrix to (zero gives the identity Matrix).
+ * @return The given Matrix raised to the given power.
+ */
+template <class T>
+Matrix<T> pow(const Matrix<T>& matrix, unsigned int exponent);
+
+/**
+ * @brief Returns the exponential of the given square Matrix (of doubles or Complex numbers),
+ *        using the scaling and squaring method with a diagonal Pade approximant.
+ *        The powers and the squarings are computed into reused scratch buffers.
+ *        Only a Matrix of floating point (or Complex) elements has an exponential.
+ *        If the given Matrix is not a square Matrix, an Exception will be thrown.
+ * @param matrix The Matrix to exponentiate.
+ * @return The exponential of the given Matrix.
+ */
+template <class T>
+FloatingResult<T, Matrix<T>> matrixExp(const Matrix<T>& matrix);
+
+/**
+ * @brief Find the order of a chain of multiplications which performs the least scalar
+ *        multiplications, by the classic matrix-chain dynamic programming.
+ * @param dimensions The dimensions of the chain, where factor i has dimensions[i] rows and
+ *        dimensions[i + 1] columns.
+ * @param split Set to the split of every sub-chain: split[i][j] is the last factor of the left
+ *        part of the product of factors i..j.
+ * @return The number of scalar multiplications in the optimal order.
+ */
+double matrixChainOrder(const std::vector<double>& dimensions,
+                        std::vector<std::vector<unsigned int>>& split);
+
+/**
+ * @brief Returns the product of the given chain of Matrices, multiplied in the order which
+ *        performs the least scalar multiplications for their dimensions.
+ *        The intermediate products are computed into scratch buffers which are reused between
+ *        the steps. If the chain is empty or the dimensions doesn't fit, an Exception will be
+ *        thrown.
+ * @param factors The Matrices to multiply, from left to right.
+ * @param cost If not null, set to the estimated cost of the naive and the optimal orders.
+ * @return The product of the chain.
+ */
+template <class T>
+Matrix<T> multiplyChain(const std::vector<const Matrix<T>*>& factors,
+                        MatrixChainCost *cost = nullptr);
+
+/**
+ * @brief Returns the product of the given chain of Matrices (e.g. multiplyChain<double>({A, B,
+ *        C})), multiplied in the order which performs the least scalar multiplications for their
+ *        dimensions. The Matrices are taken by reference, so they are not copied. If the chain
+ *        is empty or the dimensions doesn't fit, an Exception will be thrown.
+ * @param factors The Matrices to multiply, from left to right.
+ * @param cost If not null, set to the estimated cost of the naive and the optimal orders.
+ * @return The product of the chain.
+ */
+template <class T>
+Matrix<T> multiplyChain(std::initializer_list<std::reference_wrapper<const Matrix<T>>> factors,
+                        MatrixChainCost *cost = nullptr);
+
+/**
+ * @brief Returns the product of the given Matrices (e.g. multiplyChain(A, B, C)), multiplied in
+ *        the order which performs the least scalar multiplications for their dimensions.
+ *        The Matrices are taken by reference, so they are not copied, and the element type is
+ *        deduced from them. If the dimensions doesn't fit, an Exception will be thrown.
+ * @param first The first Matrix to multiply (on the left side).
+ * @param rest The other Matrices to multiply, from left to right.
+ * @return The product of the chain.
+ */
+template <class T, class... Rest>
+Matrix<T> multiplyChain(const Matrix<T>& first, const Rest&... rest);
+
+/**
+ * @brief Returns the given memory of std::complex<double> cells as memory of Complex cells,
+ *        which have the same layout, so it can be adopted by a Matrix without converting it.
+ * @param buffer The memory of std::complex<double> cells.
+ * @return The same memory, as Complex cells.
+ */
+MatrixBuffer<Complex> asComplex(const MatrixBuffer<std::complex<double>>& buffer);
+
+/**
+ * @brief Returns the given memory of Complex cells (e.g. of a Matrix) as memory of
+ *        std::complex<double> cells, which have the same layout, without converting it.
+ * @param buffer The memory of Complex cells.
+ * @return The same memory, as std::complex<double> cells.
+ */
+MatrixBuffer<std::complex<double>> asStdComplex(const MatrixBuffer<Complex>& buffer);
+
+/**
+ * @brief Returns the given read-only memory of Complex cells as read-only memory of
+ *        std::complex<double> cells, without converting it.
+ * @param buffer The read-only memory of Complex cells.
+ * @return The same memory, as std::complex<double> cells.
+ */
+MatrixBuffer<const std::complex<double>> asStdComplex(const MatrixBuffer<const Complex>& buffer);
+
+
 #include "Matrix.hpp"
 
 #endif
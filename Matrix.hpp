@@ -26,8 +26,17 @@
 
 #include <thread>
 #include <cassert>
+#include <cmath>
+#include <algorithm>
+#include <functional>
+#include <atomic>
+#include <limits>
+#include <climits>
 #include "Matrix.h"
 #include "Complex.h"
+#include "ScalarTraits.h"
+#include "MatrixKernels.h"
+#include "MatrixScheduler.h"
 
 
 /*-----=  Definitions  =-----*/
@@ -39,6 +48,12 @@
  */
 #define DEFAULT_VALUE 0
 
+/**
+ * @def IDENTITY_VALUE 1
+ * @brief A Macro that sets the value of the elements on the diagonal of an identity Matrix.
+ */
+#define IDENTITY_VALUE 1
+
 /**
  * @def EMPTY_MATRIX_SIZE 0
  * @brief A Macro that sets the size for an empty Matrix.
@@ -87,6 +102,141 @@
  */
 #define THREAD_MODE_MESSAGE_END " mode."
 
+/**
+ * @def DEFAULT_DETERMINISTIC_FLAG false
+ * @brief A Macro that sets the default deterministic flag for performing reductions.
+ */
+#define DEFAULT_DETERMINISTIC_FLAG false
+
+/**
+ * @def DEFAULT_WORKER_COUNT 1
+ * @brief A Macro that sets the number of worker threads if the number of cores is unknown.
+ */
+#define DEFAULT_WORKER_COUNT 1
+
+/**
+ * @def DEFAULT_AFFINITY_FLAG false
+ * @brief A Macro that sets the default affinity flag for pinning the worker threads.
+ */
+#define DEFAULT_AFFINITY_FLAG false
+
+/**
+ * @def ALL_CORES 0
+ * @brief A Macro that sets the worker count setting which means one worker per core.
+ */
+#define ALL_CORES 0
+
+/**
+ * @def FIRST_TOUCH_THRESHOLD 65536
+ * @brief A Macro that sets the least number of cells in a new Matrix which is initialized by the
+ *        worker threads (so each row block is first touched on the node which processes it).
+ */
+#define FIRST_TOUCH_THRESHOLD 65536
+
+/**
+ * @def DEFAULT_MIXED_PRECISION_FLAG false
+ * @brief A Macro that sets the default mixed precision flag for multiplying Matrices of double.
+ */
+#define DEFAULT_MIXED_PRECISION_FLAG false
+
+/**
+ * @def DEFAULT_GAUSS_MULTIPLICATION_FLAG false
+ * @brief A Macro that sets the default gauss multiplication flag for multiplying Matrices of
+ *        Complex numbers.
+ */
+#define DEFAULT_GAUSS_MULTIPLICATION_FLAG false
+
+/**
+ * @def GAUSS_PANEL_DEPTH 256
+ * @brief A Macro that sets the number of rows of the second Matrix in a panel of the product
+ *        of Complex Matrices by three real products.
+ */
+#define GAUSS_PANEL_DEPTH 256
+
+/**
+ * @def DEFAULT_CHECKSUM_FLAG false
+ * @brief A Macro that sets the default checksum flag for comparing Matrices.
+ */
+#define DEFAULT_CHECKSUM_FLAG false
+
+/**
+ * @def DEFAULT_COPY_ON_WRITE_FLAG false
+ * @brief A Macro that sets the default copy on write flag for copying Matrices.
+ */
+#define DEFAULT_COPY_ON_WRITE_FLAG false
+
+/**
+ * @def DEFAULT_WORK_STEALING_FLAG false
+ * @brief A Macro that sets the default work stealing flag for scheduling the parallel mode.
+ */
+#define DEFAULT_WORK_STEALING_FLAG false
+
+/**
+ * @def DEFAULT_RESULT_CACHE_FLAG false
+ * @brief A Macro that sets the default result cache flag for the Matrix operators.
+ */
+#define DEFAULT_RESULT_CACHE_FLAG false
+
+/**
+ * @def COMPARISON_BLOCK_SIZE 256
+ * @brief A Macro that sets the number of cells which are compared without a branch in an
+ *        approximate comparison.
+ */
+#define COMPARISON_BLOCK_SIZE 256
+
+/**
+ * @def LAYOUT_TILE_SIZE 64
+ * @brief A Macro that sets the number of columns which are processed together when Matrices
+ *        of different layouts are combined, so an operand in column order is read along a few
+ *        columns at a time.
+ */
+#define LAYOUT_TILE_SIZE 64
+
+/**
+ * @def INNER_SLICE_DEPTH 1024
+ * @brief A Macro that sets the least number of terms in a slice of the inner dimension, when
+ *        a product with fewer cells than workers is split along it's inner dimension.
+ */
+#define INNER_SLICE_DEPTH 1024
+
+/**
+ * @def REDUCTION_BLOCK_SIZE 4096
+ * @brief A Macro that sets the number of cells in a single block of a deterministic reduction.
+ */
+#define REDUCTION_BLOCK_SIZE 4096
+
+/**
+ * @def REDUCTION_LANES 4
+ * @brief A Macro that sets the number of independent accumulators in a reduction of a block.
+ */
+#define REDUCTION_LANES 4
+
+/**
+ * @def PADE_DEGREE 6
+ * @brief A Macro that sets the degree of the Pade approximant of the Matrix exponential.
+ */
+#define PADE_DEGREE 6
+
+/**
+ * @def EXP_SCALING_THRESHOLD 0.5
+ * @brief A Macro that sets the largest norm of a Matrix which is exponentiated directly by the
+ *        Pade approximant, without scaling and squaring.
+ */
+#define EXP_SCALING_THRESHOLD 0.5
+
+/**
+ * @def FLOPS_PER_PRODUCT 2
+ * @brief A Macro that sets the number of floating point operations of a single scalar product
+ *        in a Matrix multiplication (a multiplication and an addition).
+ */
+#define FLOPS_PER_PRODUCT 2
+
+/**
+ * @def NO_BUFFER UINT_MAX
+ * @brief A Macro that sets the scratch buffer of an operand which is a factor of the chain.
+ */
+#define NO_BUFFER UINT_MAX
+
 
 
 
@@ -96,6 +246,33 @@
 template <class T>
 bool Matrix<T>::_threadFlag = DEFAULT_THREAD_FLAG;
 
+template <class T>
+bool Matrix<T>::_deterministicFlag = DEFAULT_DETERMINISTIC_FLAG;
+
+template <class T>
+bool Matrix<T>::_affinityFlag = DEFAULT_AFFINITY_FLAG;
+
+template <class T>
+unsigned int Matrix<T>::_workerSetting = ALL_CORES;
+
+template <class T>
+bool Matrix<T>::_mixedPrecisionFlag = DEFAULT_MIXED_PRECISION_FLAG;
+
+template <class T>
+bool Matrix<T>::_gaussMultiplicationFlag = DEFAULT_GAUSS_MULTIPLICATION_FLAG;
+
+template <class T>
+bool Matrix<T>::_checksumFlag = DEFAULT_CHECKSUM_FLAG;
+
+template <class T>
+bool Matrix<T>::_copyOnWriteFlag = DEFAULT_COPY_ON_WRITE_FLAG;
+
+template <class T>
+bool Matrix<T>::_workStealingFlag = DEFAULT_WORK_STEALING_FLAG;
+
+template <class T>
+bool Matrix<T>::_resultCacheFlag = DEFAULT_RESULT_CACHE_FLAG;
+
 
 /*-----=  Constructors & Destructors  =-----*/
 
@@ -119,8 +296,26 @@ Matrix<T>::Matrix() : Matrix(INITIAL_MATRIX_SIZE, INITIAL_MATRIX_SIZE)
  * @param cols The number of columns in the Matrix.
  */
 template <class T>
-Matrix<T>::Matrix(unsigned int rows, unsigned int cols)
-        : _rows(rows), _cols(cols), _cells(_rows * _cols)
+Matrix<T>::Matrix(unsigned int rows, unsigned int cols) : Matrix(rows, cols, ROW_MAJOR)
+{
+
+}
+
+/**
+ * @brief A Constructor for a Matrix which receives the desired dimensions and the order of the
+ *        cells in the memory, and all the elements in the Matrix are set to DEFAULT_VALUE.
+ *        If one of the dimensions is invalid (i.e. equals to zero), an Exception will be thrown.
+ *        The cells of a large Matrix are set by the worker threads, block of rows (or columns)
+ *        by block, so each block is placed on the NUMA node of the worker which will process it.
+ * @param rows The number of rows in the Matrix.
+ * @param cols The number of columns in the Matrix.
+ * @param layout The order of the cells in the memory.
+ */
+template <class T>
+Matrix<T>::Matrix(unsigned int rows, unsigned int cols, MatrixLayout layout)
+        : _rows(rows), _cols(cols), _cells(_rows * _cols),
+          _rowStride(layout == ROW_MAJOR ? cols : 1), _colStride(layout == ROW_MAJOR ? 1 : rows),
+          _checksum(0), _checksumValid(false)
 {
     // The Matrix dimensions considered valid if both rows and columns are not zero or
     // if both of them are zero. (i.e. if one of them is zero and the other is not it's an error).
@@ -128,26 +323,63 @@ Matrix<T>::Matrix(unsigned int rows, unsigned int cols)
     {
         throw MatrixDimensionsException();
     }
+
+    if (_cells.size() < FIRST_TOUCH_THRESHOLD)
+    {
+        std::fill(_cells.begin(), _cells.end(), T(DEFAULT_VALUE));
+        return;
+    }
+    // Each worker touches the tile of lines it later processes (see _parallelGrid).
+    const unsigned int lineLength = (layout == ROW_MAJOR) ? _cols : _rows;
+    _parallelGrid(_rows * _cols / lineLength, lineLength,
+                  [&](unsigned int begin, unsigned int end, unsigned int from, unsigned int to)
+    {
+        for (std::size_t line = begin; line < end; line++)
+        {
+            std::fill(_cells.begin() + (line * lineLength) + from,
+                      _cells.begin() + (line * lineLength) + to, T(DEFAULT_VALUE));
+        }
+    });
 }
 
 /**
  * @brief A Copy Constructor for a Matrix which receives another Matrix and create a copy of it.
+ *        The copy owns it's cells, which are packed in row order (also if the other Matrix
+ *        adopted memory of the user in another layout).
+ *        In Copy On Write mode, the copy of an owned Matrix which is packed in row order
+ *        shares it's cells, until one of the Matrices is changed, unless references to them
+ *        were given out (see MatrixStorage::expose()), since the references would change the
+ *        copy as well.
+ *        The cached checksum is not copied, because the copy may be changed directly by the
+ *        friends of the Matrix.
  * @param other The Matrix to copy.
  */
 template <class T>
 Matrix<T>::Matrix(const Matrix<T>& other)
-        : _rows(other._rows), _cols(other._cols), _cells(other._cells)
+        : _rows(other._rows), _cols(other._cols), _rowStride(other._cols), _colStride(1),
+          _checksum(0), _checksumValid(false)
 {
-
+    if (!other._isPacked())
+    {
+        _cells = MatrixStorage<T>(other.begin(), other.end());
+    }
+    else if (_copyOnWriteFlag && other._cells.isOwner() && !other._cells.isExposed())
+    {
+        _cells = other._cells;
+    }
+    else
+    {
+        _cells = other._cells.clone();
+    }
 }
 
 /**
  * @brief A Move Constructor for a Matrix.
+ *        The other Matrix is constant, so it's cells are copied.
  * @param other The Matrix to move.
  */
 template <class T>
-Matrix<T>::Matrix(const Matrix<T> && other)
-        : _rows(other._rows), _cols(other._cols), _cells(std::move(other._cells))
+Matrix<T>::Matrix(const Matrix<T> && other) : Matrix(other)
 {
 
 }
@@ -164,7 +396,8 @@ Matrix<T>::Matrix(const Matrix<T> && other)
  */
 template <class T>
 Matrix<T>::Matrix(unsigned int rows, unsigned int cols, const std::vector<T>& cells)
-        : _rows(rows), _cols(cols), _cells(cells)
+        : _rows(rows), _cols(cols), _cells(cells.begin(), cells.end()), _rowStride(cols),
+          _colStride(1), _checksum(0), _checksumValid(false)
 {
     // The Matrix dimensions considered valid if both rows and columns are not zero or
     // if both of them are zero. (i.e. if one of them is zero and the other is not it's an error).
@@ -180,6 +413,49 @@ Matrix<T>::Matrix(unsigned int rows, unsigned int cols, const std::vector<T>& ce
     }
 }
 
+/**
+ * @brief A Constructor for a Matrix which adopts the given memory of the user without
+ *        copying it. The Matrix reads and writes the cells in place, so the memory must stay
+ *        valid while the Matrix uses it. Copies of the Matrix (and results of operations)
+ *        are independent Matrices which own their cells. A change of the memory which is not
+ *        made through the Matrix must be followed by a call to buffer(), so the cached checksum
+ *        of the Matrix is forgotten.
+ *        If one of the dimensions is invalid, if the memory is null or if the stride is
+ *        smaller than the rows (or columns) of the layout, an Exception will be thrown.
+ * @param buffer The memory to adopt.
+ */
+template <class T>
+Matrix<T>::Matrix(const MatrixBuffer<T>& buffer)
+        : _rows(buffer.rows), _cols(buffer.cols), _rowStride(buffer.stride), _colStride(1),
+          _checksum(0), _checksumValid(false)
+{
+    if ((_rows == EMPTY_MATRIX_SIZE) ^ (_cols == EMPTY_MATRIX_SIZE))
+    {
+        throw MatrixDimensionsException();
+    }
+
+    // The leading dimension holds a whole row (or column) of the layout.
+    unsigned int lines = _rows;
+    unsigned int lineLength = _cols;
+    if (buffer.layout == COLUMN_MAJOR)
+    {
+        std::swap(lines, lineLength);
+        _rowStride = 1;
+        _colStride = buffer.stride;
+    }
+    if (buffer.stride < lineLength || (buffer.data == nullptr && lines != EMPTY_MATRIX_SIZE))
+    {
+        throw MatrixDimensionsException();
+    }
+
+    std::size_t extent = 0;
+    if (lines != EMPTY_MATRIX_SIZE)
+    {
+        extent = ((std::size_t) (lines - 1) * buffer.stride) + lineLength;
+    }
+    _cells = MatrixStorage<T>(buffer.data, extent);
+}
+
 /**
  * @brief The Destructor for the Matrix.
  */
@@ -205,6 +481,16 @@ void Matrix<T>::_swapMatrix(Matrix<T>& first, Matrix<T>& second)
     swap(first._rows, second._rows);
     swap(first._cols, second._cols);
     swap(first._cells, second._cells);
+    swap(first._rowStride, second._rowStride);
+    swap(first._colStride, second._colStride);
+
+    // The cached checksums follow the cells.
+    std::uint64_t checksum = first._checksum.load();
+    bool checksumValid = first._checksumValid.load();
+    first._checksum.store(second._checksum.load());
+    first._checksumValid.store(second._checksumValid.load());
+    second._checksum.store(checksum);
+    second._checksumValid.store(checksumValid);
 }
 
 /**
@@ -219,26 +505,110 @@ template <class T>
 Matrix<T>& Matrix<T>::operator=(Matrix<T> other)
 {
     _swapMatrix(*this, other);
+    if (_changes)
+    {
+        _changes -> markAll();
+    }
     return *this;
 }
 
 /**
- * @brief An Helper Function for the Plus Operator.
- *        While working on multithread mode, this function is called from a single thread in order
- *        to perform the addition operation on a single row.
- *        Note: I had to change the name from 's_plusHelper' because of the bug in the script.
- * @param result The Matrix in which we perform the addition operation.
- * @param other The Matrix which contains the data to add.
- * @param rowNumber The current row number in the Matrices to perform the operation.
+ * @brief An Helper Function for the element-wise operators.
+ *        Combine each cell of the first Matrix with the cell of the second Matrix in the same
+ *        position, using the given operation.
+ *        Matrices in the same dense layout are combined in their storage order, and the result
+ *        gets their layout. Otherwise the result is in row order, and the cells are combined
+ *        in tiles of columns.
+ *        This function supports multithread mode, where each thread perform the operation
+ *        on a tile of lines (rows or columns) in the Matrix, see _parallelGrid.
+ * @param first The first Matrix in the operation.
+ * @param second The second Matrix in the operation, with the same dimensions.
+ * @param operation The operation, which receives the two cells and returns the result cell.
+ * @return A Matrix which holds the result of the operation on each cell.
+ */
+template <class T>
+template <class Operation>
+Matrix<T> Matrix<T>::_elementwise(const Matrix<T>& first, const Matrix<T>& second,
+                                  Operation operation)
+{
+    return _elementwise(first, second, operation,
+                        [&](const T *firstRun, const T *secondRun, T *resultRun,
+                            std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            resultRun[i] = operation(firstRun[i], secondRun[i]);
+        }
+    });
+}
+
+/**
+ * @brief An Helper Function for the element-wise operators which have a kernel.
+ *        Like the other _elementwise, but Matrices in the same dense layout are combined by
+ *        the given kernel, on a run of contiguous cells at once.
+ * @param first The first Matrix in the operation.
+ * @param second The second Matrix in the operation, with the same dimensions.
+ * @param operation The operation, which receives the two cells and returns the result cell.
+ * @param kernel The kernel, which receives the two runs of cells, the run of the result cells
+ *        and the number of cells, and performs the operation on each cell.
+ * @return A Matrix which holds the result of the operation on each cell.
  */
 template <class T>
-void Matrix<T>::_plusHelper(Matrix<T>& result, const Matrix<T>& other, unsigned int rowNumber)
+template <class Operation, class Kernel>
+Matrix<T> Matrix<T>::_elementwise(const Matrix<T>& first, const Matrix<T>& second,
+                                  Operation operation, Kernel kernel)
 {
-    assert(rowNumber < result._rows);
-    for (unsigned int colNumber = 0; colNumber < result._cols; colNumber++)
+    assert(first._rows == second._rows && first._cols == second._cols);
+
+    // In Parallel Mode each worker combines the same tile of lines it has initialized.
+    if (_sameLayout(first, second))
     {
-        result(rowNumber, colNumber) += other(rowNumber, colNumber);
+        const MatrixLayout layout = first.layout();
+        Matrix<T> result(first._rows, first._cols, layout);
+        const unsigned int lineLength = (layout == ROW_MAJOR) ? first._cols : first._rows;
+        const T *firstCells = first._cells.data();
+        const T *secondCells = second._cells.data();
+        T *destination = result._cells.data();
+        _parallelGrid(first._rows * first._cols / std::max(lineLength, 1u), lineLength,
+                      [&](unsigned int begin, unsigned int end, unsigned int from,
+                          unsigned int to)
+        {
+            // A tile of whole lines is a single run of contiguous cells.
+            if (from == 0 && to == lineLength)
+            {
+                const std::size_t offset = (std::size_t) begin * lineLength;
+                kernel(firstCells + offset, secondCells + offset, destination + offset,
+                       (std::size_t) (end - begin) * lineLength);
+                return;
+            }
+            for (std::size_t line = begin; line < end; line++)
+            {
+                const std::size_t offset = (line * lineLength) + from;
+                kernel(firstCells + offset, secondCells + offset, destination + offset,
+                       (std::size_t) (to - from));
+            }
+        });
+        return result;
     }
+
+    Matrix<T> result(first._rows, first._cols);
+    _parallelGrid(first._rows, first._cols,
+                  [&](unsigned int begin, unsigned int end, unsigned int from, unsigned int to)
+    {
+        for (unsigned int tile = from; tile < to; tile += LAYOUT_TILE_SIZE)
+        {
+            const unsigned int tileEnd = std::min(to, tile + LAYOUT_TILE_SIZE);
+            for (unsigned int row = begin; row < end; row++)
+            {
+                for (unsigned int col = tile; col < tileEnd; col++)
+                {
+                    result._cell(row, col) = operation(first._cell(row, col),
+                                                       second._cell(row, col));
+                }
+            }
+        }
+    });
+    return result;
 }
 
 /**
@@ -248,7 +618,7 @@ void Matrix<T>::_plusHelper(Matrix<T>& result, const Matrix<T>& other, unsigned
  *        This operator does not change this Matrix or the given Matrix data.
  *        If the dimensions of this Matrix doesn't fit the given Matrix, an Exception will be thrown
  *        This operator supports multithread mode, where each thread perform the operation
- *        of a single row in the Matrix.
+ *        of a tile of rows and columns in the Matrix.
  * @param other The other Matrix to add to this Matrix.
  * @return A Matrix which represent the result of the addition operation.
  */
@@ -261,33 +631,21 @@ Matrix<T> Matrix<T>::operator+(const Matrix<T>& other) const
         throw MatrixDimensionsException();
     }
 
-    // Create the Matrix to return which hold the result of the addition operation.
-    Matrix<T> result(*this);
-
-    if (_threadFlag)
+    const auto compute = [&]() -> Matrix<T>
     {
-        // Working in Parallel Mode.
-        std::vector<std::thread> rowThreads;
-        for (unsigned int currentRow = 0; currentRow < _rows; currentRow++)
+        return _elementwise(*this, other, [](const T& first, const T& second) -> T
         {
-            rowThreads.push_back(std::thread(&Matrix<T>::_plusHelper, std::ref(result),
-                                             std::ref(other), currentRow));
-        }
-        for (std::thread& thread : rowThreads)
+            return first + second;
+        }, [](const T *first, const T *second, T *result, std::size_t count)
         {
-            thread.join();
-        }
-    }
-    else
+            MatrixKernels::add(first, second, result, count);
+        });
+    };
+    if (_resultCacheFlag)
     {
-        // Working in Non-Parallel Mode.
-        for (unsigned int i = 0; i < (result._rows * result._cols); i++)
-        {
-            result._cells[i] += other._cells[i];
-        }
+        return MatrixCache<T>::shared().lookup(CACHED_ADDITION, *this, other, compute);
     }
-
-    return result;
+    return compute();
 }
 
 /**
@@ -308,15 +666,23 @@ Matrix<T> Matrix<T>::operator-(const Matrix<T>& other) const
         throw MatrixDimensionsException();
     }
 
-    // Create the Matrix to return which hold the result of the addition operation.
-    Matrix<T> result(*this);
-
-    for (unsigned int i = 0; i < (result._rows * result._cols); i++)
+    const auto compute = [&]() -> Matrix<T>
+    {
+        return _elementwise(*this, other, [](const T& first, const T& second) -> T
+        {
+            T result(first);
+            result -= second;
+            return result;
+        }, [](const T *first, const T *second, T *result, std::size_t count)
+        {
+            MatrixKernels::subtract(first, second, result, count);
+        });
+    };
+    if (_resultCacheFlag)
     {
-        result._cells[i] -= other._cells[i];
+        return MatrixCache<T>::shared().lookup(CACHED_SUBTRACTION, *this, other, compute);
     }
-
-    return result;
+    return compute();
 }
 
 /**
@@ -329,222 +695,1844 @@ Matrix<T> Matrix<T>::operator-(const Matrix<T>& other) const
      * @param first The first Matrix in the multiplication operation (on the right side).
      * @param second The second Matrix in the multiplication operation (on the left side).
      * @param rowNumber The current row number in the result Matrix to perform the operation.
+     * @param colBegin The first column of the row to compute.
+     * @param colEnd The end of the columns of the row to compute.
      */
 template <class T>
 void Matrix<T>::_multiHelper(Matrix<T>& result, const Matrix<T>& first, const Matrix<T>& second,
-                             unsigned int rowNumber)
+                             unsigned int rowNumber, unsigned int colBegin, unsigned int colEnd)
 {
-    assert(rowNumber < result._rows);
-    for (unsigned int j = 0; j < second._cols; j++)
+    assert(rowNumber < result._rows && colEnd <= result._cols);
+    for (unsigned int j = colBegin; j < colEnd; j++)
     {
         T sum(DEFAULT_VALUE);
         for (unsigned int k = 0; k < first._cols; k++)
         {
-            sum += first(rowNumber, k) * second(k, j);
+            sum += first._cell(rowNumber, k) * second._cell(k, j);
         }
-        result(rowNumber, j) = sum;
+        result._cell(rowNumber, j) = sum;
     }
 }
 
 /**
- * @brief An operator overload for the multiplication operator '*'.
- *        The operator multiply this Matrix with the given other Matrix and return a new Matrix
- *        which represent the result of the multiplication operation.
- *        This operator does not change this Matrix or the given Matrix data.
- *        If the dimensions of this Matrix doesn't fit the given Matrix, an Exception will be thrown
- *        This operator supports multithread mode, where each thread perform the operation
- *        of a single row in the Matrix.
- * @param other The other Matrix to multiply to this Matrix.
- * @return A Matrix which represent the result of the multiplication operation.
+ * @brief An Helper Function for the Multiply Operator.
+ *        This function perform the multiplication operation for a single row, by adding each
+ *        row of the second Matrix, scaled by the matching cell of the first Matrix, to the row
+ *        of the result, so the rows of a second Matrix in row order are read sequentially.
+ *        Each cell is accumulated in the same order as in _multiHelper.
+ * @param result The Matrix in which we perform the multiplication operation.
+ * @param first The first Matrix in the multiplication operation (on the left side).
+ * @param second The second Matrix in the multiplication operation (on the right side).
+ * @param rowNumber The current row number in the result Matrix to perform the operation.
+ * @param colBegin The first column of the row to compute.
+ * @param colEnd The end of the columns of the row to compute.
  */
 template <class T>
-Matrix<T> Matrix<T>::operator*(const Matrix<T>& other) const
+void Matrix<T>::_multiRowHelper(Matrix<T>& result, const Matrix<T>& first,
+                                const Matrix<T>& second, unsigned int rowNumber,
+                                unsigned int colBegin, unsigned int colEnd)
 {
-    // If the two Matrices dimensions does not fit for this operation.
-    if (this -> _cols != other._rows)
-    {
-        throw MatrixDimensionsException();
-    }
-
-    // Create the Matrix to return which hold the result of the addition operation.
-    Matrix<T> result(this -> _rows, other._cols);
-
-    if (_threadFlag)
+    assert(rowNumber < result._rows && colEnd <= result._cols);
+    for (unsigned int j = colBegin; j < colEnd; j++)
     {
-        // Working in Parallel Mode.
-        std::vector<std::thread> rowThreads;
-        for (unsigned int currentRow = 0; currentRow < _rows; currentRow++)
-        {
-            rowThreads.push_back(std::thread(&Matrix<T>::_multiHelper, std::ref(result),
-                                             std::ref(*this), std::ref(other), currentRow));
-        }
-        for (std::thread& thread : rowThreads)
-        {
-            thread.join();
-        }
+        result._cell(rowNumber, j) = T(DEFAULT_VALUE);
     }
-    else
+    for (unsigned int k = 0; k < first._cols; k++)
     {
-        // Working in Non-Parallel Mode.
-        for (unsigned int rowNumber = 0; rowNumber < this -> _rows; rowNumber++)
+        const T& scale = first._cell(rowNumber, k);
+        for (unsigned int j = colBegin; j < colEnd; j++)
         {
-            _multiHelper(result, *this, other, rowNumber);
+            result._cell(rowNumber, j) += scale * second._cell(k, j);
         }
     }
-
-
-    return result;
 }
 
 /**
- * @brief An operator overload for the comparison operator '=='.
- *        The operator determine if this Matrix is equal to the given other Matrix,
- *        i.e. equality in each cell of the Matrices.
- * @param other The other Matrix to check.
- * @return true if the Matrices are equal, false otherwise.
+ * @brief Perform the multiplication operation of the given Matrices into the given result
+ *        Matrix in row order, with the row kernel which fits the layout of the second Matrix:
+ *        a second Matrix in column order is multiplied by dot products of it's columns
+ *        (_multiHelper), and a second Matrix in row order by scaled rows (_multiRowHelper).
+ *        In parallel mode each worker computes a tile of the result (see _parallelGrid), and
+ *        a product with fewer cells than workers is split along it's inner dimension instead.
+ * @param result The Matrix which holds the result of the multiplication operation.
+ * @param first The first Matrix in the multiplication operation (on the left side).
+ * @param second The second Matrix in the multiplication operation (on the right side).
  */
 template <class T>
-bool Matrix<T>::operator==(const Matrix<T>& other) const
+void Matrix<T>::_multiplyRows(Matrix<T>& result, const Matrix<T>& first,
+                              const Matrix<T>& second)
 {
-    // Check Dimensions first.
-    if (this -> _rows != other._rows || this -> _cols != other._cols)
+    const unsigned int slices = _innerSlices(first._rows, second._cols, first._cols);
+    if (slices > 1)
     {
-        return false;
+        _multiplySlices(result, first, second, slices);
+        return;
     }
 
-    // Check equality in each cell.
-    for (unsigned int i = 0; i < (_rows * _cols); i++)
+    const bool columnOrder = second.layout() == COLUMN_MAJOR;
+    _parallelGrid(first._rows, second._cols,
+                  [&](unsigned int begin, unsigned int end, unsigned int from, unsigned int to)
     {
-        if (_cells[i] != other._cells[i])
+        for (unsigned int rowNumber = begin; rowNumber < end; rowNumber++)
         {
-            return false;
+            if (columnOrder)
+            {
+                _multiHelper(result, first, second, rowNumber, from, to);
+            }
+            else
+            {
+                _multiRowHelper(result, first, second, rowNumber, from, to);
+            }
         }
-    }
-    return true;
+    });
 }
 
 /**
- * @brief An operator overload for the comparison operator '!='.
- *        The operator determine if this Matrix is not equal to the given other Matrix,
- *        i.e. at least in one cell there is non-equality.
- * @param other The other Matrix to check.
- * @return true if the Matrices are not equal, false otherwise.
+ * @brief Returns the number of slices of the inner dimension in which a product of the given
+ *        dimensions is computed. Only a product with fewer cells than workers is split, into
+ *        slices of at least INNER_SLICE_DEPTH terms, and in deterministic mode it isn't split
+ *        at all (so the cells are summed in the same order as in non-parallel mode).
+ * @param rows The number of rows in the result Matrix.
+ * @param cols The number of columns in the result Matrix.
+ * @param inner The number of columns in the first Matrix.
+ * @return The number of slices, or 1 if the inner dimension is not split.
  */
 template <class T>
-bool Matrix<T>::operator!=(const Matrix<T>& other) const
+unsigned int Matrix<T>::_innerSlices(unsigned int rows, unsigned int cols, unsigned int inner)
 {
-    return !(*this == other);
+    if (!_threadFlag || _deterministicFlag)
+    {
+        return 1;
+    }
+    const unsigned long cells = (unsigned long) rows * cols;
+    const unsigned int workers = _workerCount();
+    if (cells == EMPTY_MATRIX_SIZE || cells >= workers)
+    {
+        return 1;
+    }
+    return std::max(1u, std::min((unsigned int) (workers / cells), inner / INNER_SLICE_DEPTH));
 }
 
 /**
- * @brief Perform the Transpose operation on this Matrix.
- *        This operator does not change this Matrix data.
- * @return A Matrix which represent the result of the Transpose operation.
+ * @brief Perform the multiplication operation of the given Matrices into the given result
+ *        Matrix by splitting the inner dimension into the given number of slices. Each slice
+ *        is multiplied by a separate worker into partial sums, which are then added pairwise
+ *        in a fixed tree order.
+ * @param result The Matrix which holds the result of the multiplication operation.
+ * @param first The first Matrix in the multiplication operation (on the left side).
+ * @param second The second Matrix in the multiplication operation (on the right side).
+ * @param slices The number of slices of the inner dimension.
  */
 template <class T>
-Matrix<T> Matrix<T>::trans() const
+void Matrix<T>::_multiplySlices(Matrix<T>& result, const Matrix<T>& first,
+                                const Matrix<T>& second, unsigned int slices)
 {
-    Matrix<T> result(_cols, _rows);
-    for (unsigned int row = 0; row < _rows; row++)
+    const std::size_t cells = (std::size_t) result._rows * result._cols;
+    std::vector<T> partials(slices * cells, T(DEFAULT_VALUE));
+    _parallelFor(slices, [&](unsigned int begin, unsigned int end)
     {
-        for (unsigned int col = 0; col < _cols; col++)
+        for (unsigned int slice = begin; slice < end; slice++)
         {
-            result(col, row) = (*this)(row, col);
+            const unsigned int kBegin = _blockBegin(first._cols, slices, slice);
+            const unsigned int kEnd = _blockBegin(first._cols, slices, slice + 1);
+            T *sums = partials.data() + (slice * cells);
+            for (unsigned int i = 0; i < result._rows; i++)
+            {
+                for (unsigned int j = 0; j < result._cols; j++)
+                {
+                    T sum(DEFAULT_VALUE);
+                    for (unsigned int k = kBegin; k < kEnd; k++)
+                    {
+                        sum += first._cell(i, k) * second._cell(k, j);
+                    }
+                    sums[(i * result._cols) + j] = sum;
+                }
+            }
         }
-    }
-    return result;
-
-}
+    });
 
-/**
- * @brief Perform the Conjugate Transpose operation on this Matrix.
- *        This operator does not change this Matrix data.
- * @return A Matrix which represent the result of the Conjugate Transpose operation.
- */
-template <>
-Matrix<Complex> Matrix<Complex>::trans() const
-{
-    Matrix<Complex> result(_cols, _rows);
-    for (unsigned int row = 0; row < _rows; row++)
+    _combineSlices(partials, slices, cells);
+    for (unsigned int i = 0; i < result._rows; i++)
     {
-        for (unsigned int col = 0; col < _cols; col++)
+        for (unsigned int j = 0; j < result._cols; j++)
         {
-            result(col, row) = ((*this)(row, col)).conj();
+            result._cell(i, j) = partials[(i * result._cols) + j];
         }
     }
-    return result;
-
 }
 
 /**
- * @brief An operator overload for the output stream operator '<<'.
- *        The operator creates an output format for a Matrix and sets the given output stream
- *        with it.
- *        The format of a Matrix output is:
- *          Each row of the Matrix is in it's own row, and all the cells in the row are separated
- *          by a single tab.
- * @param out The output stream to set with the Matrix representation.
- * @param matrix The Matrix to print to the output stream.
- * @return An output stream with the Matrix representation.
+ * @brief Add the partial sums of the slices of a split product pairwise, in a fixed tree
+ *        order, into the partial sums of the first slice.
+ * @param partials The partial sums, 'cells' consecutive sums for each slice.
+ * @param slices The number of slices.
+ * @param cells The number of cells in the product.
  */
 template <class T>
-std::ostream& operator<<(std::ostream& out, const Matrix<T>& matrix)
+template <class R>
+void Matrix<T>::_combineSlices(std::vector<R>& partials, unsigned int slices, std::size_t cells)
 {
-    for (unsigned int i = 0; i < matrix._rows; i++)
+    for (unsigned int width = 1; width < slices; width *= 2)
     {
-        for (unsigned int j = 0; j < matrix._cols; j++)
+        for (unsigned int slice = 0; slice + width < slices; slice += 2 * width)
         {
-            out << matrix(i, j) << CELL_SEPARATOR;
+            R *target = partials.data() + (slice * cells);
+            const R *source = partials.data() + ((slice + width) * cells);
+            for (std::size_t i = 0; i < cells; i++)
+            {
+                target[i] += source[i];
+            }
         }
-        out << std::endl;
     }
-    return out;
 }
 
 /**
- * @brief An operator overload for the access operation '()'.
- *        The operator gives access to the element in the Matrix in the given row and column
- *        by calling the Matrix with the operator as - matrixName(row, col).
- *        This function returns a const reference to the element in the requested cell, and
- *        the user can only read the data and cannot change it.
- *        If one of the given indices to access are invalid, an Exception will be thrown.
- * @param rowNumber The row number in the Matrix to access.
- * @param colNumber The column number in the Matrix to access.
- * @return A read-only access to the element in the given indices in the Matrix.
+ * @brief If the given result Matrix is in column order, perform the multiplication operation
+ *        as the product of the transposed operands ((A * B)^T = B^T * A^T) into the transposed
+ *        result, which are all views of the same cells in row order.
+ * @param result The Matrix which holds the result of the multiplication operation.
+ * @param first The first Matrix in the multiplication operation (on the left side).
+ * @param second The second Matrix in the multiplication operation (on the right side).
+ * @param exact Whether the product ignores the Mixed Precision and the Gauss Multiplication
+ *              Flags.
+ * @return true if the multiplication operation was performed, false if the result Matrix is
+ *         in row order.
  */
 template <class T>
-const T& Matrix<T>::operator()(unsigned int rowNumber, unsigned int colNumber) const
+bool Matrix<T>::_multiplyTransposed(Matrix<T>& result, const Matrix<T>& first,
+                                    const Matrix<T>& second, bool exact)
 {
-    // Check that the given indices are in the Matrix boundaries.
-    if (rowNumber >= _rows || colNumber >= _cols)
+    if (result.layout() != COLUMN_MAJOR)
     {
-        throw MatrixIndexException();
+        return false;
+    }
+    Matrix<T> resultView(EMPTY_MATRIX_SIZE, EMPTY_MATRIX_SIZE);
+    Matrix<T> firstView(EMPTY_MATRIX_SIZE, EMPTY_MATRIX_SIZE);
+    Matrix<T> secondView(EMPTY_MATRIX_SIZE, EMPTY_MATRIX_SIZE);
+    _transposeView(result, resultView, true);
+    _transposeView(second, firstView, true);
+    _transposeView(first, secondView, true);
+    _multiply(resultView, firstView, secondView, exact);
+    return true;
+}
+
+/**
+ * @brief An operator overload for the multiplication operator '*'.
+ *        The operator multiply this Matrix with the given other Matrix and return a new Matrix
+ *        which represent the result of the multiplication operation.
+ *        This operator does not change this Matrix or the given Matrix data.
+ *        If the dimensions of this Matrix doesn't fit the given Matrix, an Exception will be thrown
+ *        This operator supports multithread mode, where each thread perform the operation
+ *        of a tile of rows and columns in the Matrix.
+ * @param other The other Matrix to multiply to this Matrix.
+ * @return A Matrix which represent the result of the multiplication operation.
+ */
+template <class T>
+Matrix<T> Matrix<T>::operator*(const Matrix<T>& other) const
+{
+    // If the two Matrices dimensions does not fit for this operation.
+    if (this -> _cols != other._rows)
+    {
+        throw MatrixDimensionsException();
+    }
+
+    const auto compute = [&]() -> Matrix<T>
+    {
+        return _product(*this, other);
+    };
+    if (_resultCacheFlag)
+    {
+        // The products in float precision (or by three real products) differ from the exact
+        // ones, so they are kept apart.
+        MatrixCacheOperation operation = CACHED_MULTIPLICATION;
+        if (_mixedPrecisionFlag)
+        {
+            operation = CACHED_MIXED_MULTIPLICATION;
+        }
+        else if (_gaussMultiplicationFlag)
+        {
+            operation = CACHED_GAUSS_MULTIPLICATION;
+        }
+        return MatrixCache<T>::shared().lookup(operation, *this, other, compute);
+    }
+    return compute();
+}
+
+/**
+ * @brief Perform the multiplication operation of the given Matrices into the given result
+ *        Matrix, without allocating a new Matrix.
+ *        The result Matrix must already have the dimensions of the product, and it must not
+ *        be one of the multiplied Matrices.
+ *        This function supports multithread mode, where each thread perform the operation
+ *        of a tile of rows and columns in the Matrix.
+ * @param result The Matrix which holds the result of the multiplication operation.
+ * @param first The first Matrix in the multiplication operation (on the left side).
+ * @param second The second Matrix in the multiplication operation (on the right side).
+ * @param exact Whether the product ignores the Mixed Precision and the Gauss Multiplication
+ *              Flags (which only the double and Complex products use).
+ */
+template <class T>
+void Matrix<T>::_multiply(Matrix<T>& result, const Matrix<T>& first, const Matrix<T>& second,
+                          bool exact)
+{
+    assert(result._rows == first._rows && result._cols == second._cols);
+    assert(&result != &first && &result != &second);
+
+    result._detach();
+    if (!_multiplyTransposed(result, first, second, exact))
+    {
+        _multiplyRows(result, first, second);
+    }
+}
+
+/**
+ * @brief Returns the product of the given Matrices, in column order if both of them are.
+ *        It doesn't check the dimensions of the Matrices, and it doesn't use the result cache.
+ * @param first The first Matrix in the multiplication operation (on the left side).
+ * @param second The second Matrix in the multiplication operation (on the right side).
+ * @param exact Whether the product ignores the Mixed Precision and the Gauss Multiplication
+ *              Flags.
+ * @return A Matrix which represent the result of the multiplication operation.
+ */
+template <class T>
+Matrix<T> Matrix<T>::_product(const Matrix<T>& first, const Matrix<T>& second, bool exact)
+{
+    // Create the Matrix to return which hold the result of the multiplication operation.
+    // The product of two Matrices in column order is computed in column order.
+    MatrixLayout layout = ROW_MAJOR;
+    if (first.layout() == COLUMN_MAJOR && second.layout() == COLUMN_MAJOR)
+    {
+        layout = COLUMN_MAJOR;
+    }
+    Matrix<T> result(first._rows, second._cols, layout);
+    _multiply(result, first, second, exact);
+    return result;
+}
+
+/**
+ * @brief Perform the multiplication operation of the given int Matrices into the given result
+ *        Matrix, accumulating each cell in 64 bits.
+ *        If a cell of the result doesn't fit an int, or one of it's sums doesn't fit 64 bits,
+ *        an Exception will be thrown.
+ * @param result The Matrix which holds the result of the multiplication operation.
+ * @param first The first Matrix in the multiplication operation (on the left side).
+ * @param second The second Matrix in the multiplication operation (on the right side).
+ * @param exact Unused, the int product is always exact.
+ */
+template <>
+inline void Matrix<int>::_multiply(Matrix<int>& result, const Matrix<int>& firstMatrix,
+                                   const Matrix<int>& secondMatrix, bool)
+{
+    assert(result._rows == firstMatrix._rows && result._cols == secondMatrix._cols);
+    assert(&result != &firstMatrix && &result != &secondMatrix);
+    result._detach();
+    if (_multiplyTransposed(result, firstMatrix, secondMatrix, true))
+    {
+        return;
+    }
+    assert(result._isPacked());
+
+    std::unique_ptr<Matrix<int>> firstScratch, secondScratch;
+    const Matrix<int>& first = _packed(firstMatrix, firstScratch);
+    const Matrix<int>& second = _packed(secondMatrix, secondScratch);
+
+    // An Exception cannot leave a worker thread, so the workers only report the overflow.
+    std::atomic<bool> overflow(false);
+    const unsigned int slices = _innerSlices(first._rows, second._cols, first._cols);
+    if (slices > 1)
+    {
+        // The partial sums of the slices are kept in 64 bits, so only their total may exceed an
+        // int, and they are added with a check for an overflow of 64 bits as well.
+        const std::size_t cells = (std::size_t) result._rows * result._cols;
+        std::vector<long long> partials(slices * cells);
+        _parallelFor(slices, [&](unsigned int begin, unsigned int end)
+        {
+            for (unsigned int slice = begin; slice < end; slice++)
+            {
+                const unsigned int kBegin = _blockBegin(first._cols, slices, slice);
+                const unsigned int kEnd = _blockBegin(first._cols, slices, slice + 1);
+                for (unsigned int rowNumber = 0; rowNumber < first._rows; rowNumber++)
+                {
+                    if (!MatrixKernels::multiplyRow(
+                            first._cells.data() + (rowNumber * first._cols) + kBegin,
+                            second._cells.data() + ((std::size_t) kBegin * second._cols),
+                            nullptr, kEnd - kBegin, second._cols, second._cols,
+                            partials.data() + (slice * cells) + (rowNumber * second._cols)))
+                    {
+                        overflow = true;
+                    }
+                }
+            }
+        });
+        for (unsigned int slice = 1; slice < slices; slice++)
+        {
+            if (!MatrixKernels::accumulate(partials.data(), partials.data() + (slice * cells),
+                                           cells))
+            {
+                overflow = true;
+            }
+        }
+        for (std::size_t i = 0; i < cells; i++)
+        {
+            overflow = overflow || (partials[i] < INT_MIN) || (partials[i] > INT_MAX);
+            result._cells[i] = (int) partials[i];
+        }
+    }
+    else
+    {
+        _parallelGrid(first._rows, second._cols,
+                      [&](unsigned int begin, unsigned int end, unsigned int from,
+                          unsigned int to)
+        {
+            std::vector<long long> accumulators(to - from);
+            for (unsigned int rowNumber = begin; rowNumber < end; rowNumber++)
+            {
+                if (!MatrixKernels::multiplyRow(
+                        first._cells.data() + (rowNumber * first._cols),
+                        second._cells.data() + from,
+                        result._cells.data() + (rowNumber * result._cols) + from,
+                        first._cols, to - from, second._cols, accumulators.data()))
+                {
+                    overflow = true;
+                }
+            }
+        });
+    }
+
+    if (overflow)
+    {
+        throw MatrixOverflowException();
+    }
+}
+
+/**
+ * @brief Round the cells of the given Matrix of double to float, in row order.
+ *        The cells are read in the order of the layout of the Matrix.
+ * @param matrix The Matrix to pack.
+ * @param cells The packed cells.
+ */
+template <>
+inline void Matrix<double>::_packFloats(const Matrix<double>& matrix, std::vector<float>& cells)
+{
+    const bool columnOrder = matrix.layout() == COLUMN_MAJOR;
+    cells.resize((std::size_t) matrix._rows * matrix._cols);
+    for (unsigned int i = 0; i < (columnOrder ? matrix._cols : matrix._rows); i++)
+    {
+        for (unsigned int j = 0; j < (columnOrder ? matrix._rows : matrix._cols); j++)
+        {
+            const unsigned int row = columnOrder ? j : i;
+            const unsigned int col = columnOrder ? i : j;
+            cells[((std::size_t) row * matrix._cols) + col] = (float) matrix._cell(row, col);
+        }
+    }
+}
+
+/**
+ * @brief Perform the multiplication operation of the given double Matrices into the given
+ *        result Matrix. If the Mixed Precision Flag is on, each operand is rounded to float
+ *        once, into a packed copy (see _packFloats), and the rows of the result are
+ *        accumulated in double from the float copies. So the products read half of the bytes
+ *        of the double operands, and the copies take half of their memory.
+ * @param result The Matrix which holds the result of the multiplication operation.
+ * @param first The first Matrix in the multiplication operation (on the left side).
+ * @param second The second Matrix in the multiplication operation (on the right side).
+ * @param exact Whether the product ignores the Mixed Precision Flag.
+ */
+template <>
+inline void Matrix<double>::_multiply(Matrix<double>& result, const Matrix<double>& first,
+                                      const Matrix<double>& second, bool exact)
+{
+    assert(result._rows == first._rows && result._cols == second._cols);
+    assert(&result != &first && &result != &second);
+    result._detach();
+    if (_multiplyTransposed(result, first, second, exact))
+    {
+        return;
+    }
+    assert(result._isPacked());
+
+    if (exact || !_mixedPrecisionFlag)
+    {
+        _multiplyRows(result, first, second);
+        return;
+    }
+
+    const unsigned int rows = first._rows;
+    const unsigned int inner = first._cols;
+    const unsigned int cols = second._cols;
+    std::vector<float> firstCells;
+    std::vector<float> secondCells;
+    _packFloats(first, firstCells);
+    _packFloats(second, secondCells);
+
+    const unsigned int slices = _innerSlices(rows, cols, inner);
+    if (slices > 1)
+    {
+        const std::size_t cells = (std::size_t) rows * cols;
+        std::vector<double> partials(slices * cells);
+        _parallelFor(slices, [&](unsigned int begin, unsigned int end)
+        {
+            for (unsigned int slice = begin; slice < end; slice++)
+            {
+                const unsigned int kBegin = _blockBegin(inner, slices, slice);
+                const unsigned int kEnd = _blockBegin(inner, slices, slice + 1);
+                for (unsigned int row = 0; row < rows; row++)
+                {
+                    MatrixKernels::multiplyRow(
+                            firstCells.data() + ((std::size_t) row * inner) + kBegin,
+                            secondCells.data() + ((std::size_t) kBegin * cols),
+                            partials.data() + (slice * cells) + ((std::size_t) row * cols),
+                            kEnd - kBegin, cols, cols);
+                }
+            }
+        });
+        _combineSlices(partials, slices, cells);
+        std::copy(partials.begin(), partials.begin() + cells, result._cells.begin());
+        return;
+    }
+
+    _parallelGrid(rows, cols,
+                  [&](unsigned int begin, unsigned int end, unsigned int from, unsigned int to)
+    {
+        for (unsigned int row = begin; row < end; row++)
+        {
+            MatrixKernels::multiplyRow(firstCells.data() + ((std::size_t) row * inner),
+                                       secondCells.data() + from,
+                                       result._cells.data() + ((std::size_t) row * cols) + from,
+                                       inner, to - from, cols);
+        }
+    });
+}
+
+/**
+ * @brief Pack the real parts, the imaginary parts and the sums of both of the given block of
+ *        cells of the given Complex Matrix into three consecutive blocks of double in row
+ *        order. The cells are read in the order of the layout of the Matrix.
+ * @param matrix The Matrix to pack.
+ * @param rowBegin The first row of the block.
+ * @param rowEnd The end of the rows of the block.
+ * @param colBegin The first column of the block.
+ * @param colEnd The end of the columns of the block.
+ * @param parts The packed parts.
+ */
+template <>
+inline void Matrix<Complex>::_packParts(const Matrix<Complex>& matrix, unsigned int rowBegin,
+                                        unsigned int rowEnd, unsigned int colBegin,
+                                        unsigned int colEnd, std::vector<double>& parts)
+{
+    const unsigned int width = colEnd - colBegin;
+    const std::size_t size = (std::size_t) (rowEnd - rowBegin) * width;
+    const bool columnOrder = matrix.layout() == COLUMN_MAJOR;
+    parts.resize(3 * size);
+    for (unsigned int i = 0; i < (columnOrder ? width : rowEnd - rowBegin); i++)
+    {
+        for (unsigned int j = 0; j < (columnOrder ? rowEnd - rowBegin : width); j++)
+        {
+            const unsigned int row = columnOrder ? j : i;
+            const unsigned int col = columnOrder ? i : j;
+            const Complex& cell = matrix._cell(rowBegin + row, colBegin + col);
+            const std::size_t index = ((std::size_t) row * width) + col;
+            parts[index] = cell.getReal();
+            parts[size + index] = cell.getImaginary();
+            parts[(2 * size) + index] = cell.getReal() + cell.getImaginary();
+        }
+    }
+}
+
+/**
+ * @brief Perform the multiplication operation of the given Complex Matrices into the given
+ *        result Matrix. If the Gauss Multiplication Flag is on, the result is computed from
+ *        three real products of the parts of the Matrices:
+ *              P1 = Ar * Br,  P2 = Ai * Bi,  P3 = (Ar + Ai) * (Br + Bi)
+ *              real = P1 - P2,  imaginary = P3 - P1 - P2
+ *        The inner dimension is walked in panels of GAUSS_PANEL_DEPTH, and the parts of each
+ *        panel are packed into Matrices of double (see _packParts) while they are multiplied,
+ *        so the extra memory is bounded by the panels and not by the Matrices.
+ *        Like the other products, each worker computes a tile of the result, and a product
+ *        with fewer cells than workers is split along it's inner dimension.
+ * @param result The Matrix which holds the result of the multiplication operation.
+ * @param first The first Matrix in the multiplication operation (on the left side).
+ * @param second The second Matrix in the multiplication operation (on the right side).
+ * @param exact Whether the product ignores the Gauss Multiplication Flag.
+ */
+template <>
+inline void Matrix<Complex>::_multiply(Matrix<Complex>& result, const Matrix<Complex>& first,
+                                       const Matrix<Complex>& second, bool exact)
+{
+    assert(result._rows == first._rows && result._cols == second._cols);
+    assert(&result != &first && &result != &second);
+    result._detach();
+    if (exact || !_gaussMultiplicationFlag)
+    {
+        if (!_multiplyTransposed(result, first, second, true))
+        {
+            _multiplyRows(result, first, second);
+        }
+        return;
+    }
+
+    // Add the three products of the rows [begin, end) and the columns [from, to) over the inner
+    // range [kBegin, kEnd) to the given sums, which hold the three products one after the other.
+    const auto accumulate = [&](unsigned int begin, unsigned int end, unsigned int from,
+                                unsigned int to, unsigned int kBegin, unsigned int kEnd,
+                                double *sums)
+    {
+        const unsigned int height = end - begin;
+        const unsigned int width = to - from;
+        const std::size_t partSize = (std::size_t) height * width;
+        std::vector<double> firstPanel;
+        std::vector<double> secondPanel;
+        std::vector<double> products(width);
+        for (unsigned int depth = kBegin; depth < kEnd; depth += GAUSS_PANEL_DEPTH)
+        {
+            const unsigned int panelDepth = std::min(kEnd - depth,
+                                                     (unsigned int) GAUSS_PANEL_DEPTH);
+            _packParts(first, begin, end, depth, depth + panelDepth, firstPanel);
+            _packParts(second, depth, depth + panelDepth, from, to, secondPanel);
+            for (unsigned int row = 0; row < height; row++)
+            {
+                for (unsigned int part = 0; part < 3; part++)
+                {
+                    MatrixKernels::multiplyRow(
+                            firstPanel.data() + (part * (std::size_t) height * panelDepth) +
+                            ((std::size_t) row * panelDepth),
+                            secondPanel.data() + (part * (std::size_t) panelDepth * width),
+                            products.data(), panelDepth, width, width);
+                    double *target = sums + (part * partSize) + ((std::size_t) row * width);
+                    for (unsigned int j = 0; j < width; j++)
+                    {
+                        target[j] += products[j];
+                    }
+                }
+            }
+        }
+    };
+
+    // Set the rows [begin, end) and the columns [from, to) of the result from their sums.
+    const auto combine = [&](unsigned int begin, unsigned int end, unsigned int from,
+                             unsigned int to, const double *sums)
+    {
+        const unsigned int width = to - from;
+        const std::size_t partSize = (std::size_t) (end - begin) * width;
+        for (unsigned int row = begin; row < end; row++)
+        {
+            for (unsigned int j = 0; j < width; j++)
+            {
+                const std::size_t index = ((std::size_t) (row - begin) * width) + j;
+                const double real = sums[index];
+                const double imaginary = sums[partSize + index];
+                result._cell(row, from + j) = Complex(real - imaginary,
+                                                      sums[(2 * partSize) + index] - real -
+                                                      imaginary);
+            }
+        }
+    };
+
+    const unsigned int rows = first._rows;
+    const unsigned int inner = first._cols;
+    const unsigned int cols = second._cols;
+    const unsigned int slices = _innerSlices(rows, cols, inner);
+    if (slices > 1)
+    {
+        const std::size_t sums = 3 * (std::size_t) rows * cols;
+        std::vector<double> partials(slices * sums);
+        _parallelFor(slices, [&](unsigned int begin, unsigned int end)
+        {
+            for (unsigned int slice = begin; slice < end; slice++)
+            {
+                accumulate(0, rows, 0, cols, _blockBegin(inner, slices, slice),
+                           _blockBegin(inner, slices, slice + 1),
+                           partials.data() + (slice * sums));
+            }
+        });
+        _combineSlices(partials, slices, sums);
+        combine(0, rows, 0, cols, partials.data());
+        return;
+    }
+
+    _parallelGrid(rows, cols,
+                  [&](unsigned int begin, unsigned int end, unsigned int from, unsigned int to)
+    {
+        std::vector<double> sums(3 * (std::size_t) (end - begin) * (to - from));
+        accumulate(begin, end, from, to, 0, inner, sums.data());
+        combine(begin, end, from, to, sums.data());
+    });
+}
+
+/**
+ * @brief An operator overload for the comparison operator '=='.
+ *        The operator determine if this Matrix is equal to the given other Matrix,
+ *        i.e. equality in each cell of the Matrices.
+ * @param other The other Matrix to check.
+ * @return true if the Matrices are equal, false otherwise.
+ */
+template <class T>
+bool Matrix<T>::operator==(const Matrix<T>& other) const
+{
+    // Check Dimensions first.
+    if (this -> _rows != other._rows || this -> _cols != other._cols)
+    {
+        return false;
+    }
+
+    if (_differentChecksums(*this, other,
+                            std::integral_constant<bool, ScalarTraits<T>::exactEquality &&
+                                                         ScalarTraits<T>::hashable>()))
+    {
+        return false;
+    }
+
+    // Check equality in each cell, in the storage order if both Matrices have the same layout.
+    if (_sameLayout(*this, other))
+    {
+        for (std::size_t i = 0; i < ((std::size_t) _rows * _cols); i++)
+        {
+            if (_cells[i] != other._cells[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    for (unsigned int tile = 0; tile < _cols; tile += LAYOUT_TILE_SIZE)
+    {
+        const unsigned int tileEnd = std::min(_cols, tile + LAYOUT_TILE_SIZE);
+        for (unsigned int row = 0; row < _rows; row++)
+        {
+            for (unsigned int col = tile; col < tileEnd; col++)
+            {
+                if (_cell(row, col) != other._cell(row, col))
+                {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief An operator overload for the comparison operator '!='.
+ *        The operator determine if this Matrix is not equal to the given other Matrix,
+ *        i.e. at least in one cell there is non-equality.
+ * @param other The other Matrix to check.
+ * @return true if the Matrices are not equal, false otherwise.
+ */
+template <class T>
+bool Matrix<T>::operator!=(const Matrix<T>& other) const
+{
+    return !(*this == other);
+}
+
+/**
+ * @brief Determine if this Matrix is approximately equal to the given other Matrix, i.e.
+ *        for each cell |a - b| <= atol + rtol * |b|, where b is the cell of the other
+ *        Matrix. The cells are compared in place, in blocks without branches, so the
+ *        comparison vectorizes, and it stops after the first block with a different cell.
+ *        Matrices with different layouts are compared in tiles of columns (like operator==).
+ * @param other The other Matrix to check.
+ * @param rtol The relative tolerance.
+ * @param atol The absolute tolerance.
+ * @return true if the Matrices have the same dimensions and all their cells are
+ *         approximately equal, false otherwise.
+ */
+template <class T>
+bool Matrix<T>::approxEqual(const Matrix<T>& other, double rtol, double atol) const
+{
+    if (this -> _rows != other._rows || this -> _cols != other._cols)
+    {
+        return false;
+    }
+
+    const auto isClose = [rtol, atol](const T& first, const T& second) -> bool
+    {
+        return ScalarTraits<T>::abs(first - second) <=
+               atol + (rtol * ScalarTraits<T>::abs(second));
+    };
+
+    // Compare the cells in the storage order if both Matrices have the same layout.
+    if (_sameLayout(*this, other))
+    {
+        const T *first = _cells.data();
+        const T *second = other._cells.data();
+        const unsigned int count = _rows * _cols;
+        for (unsigned int begin = 0; begin < count; begin += COMPARISON_BLOCK_SIZE)
+        {
+            unsigned int end = std::min(count, begin + COMPARISON_BLOCK_SIZE);
+            bool close = true;
+            for (unsigned int i = begin; i < end; i++)
+            {
+                close &= isClose(first[i], second[i]);
+            }
+            if (!close)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    for (unsigned int tile = 0; tile < _cols; tile += LAYOUT_TILE_SIZE)
+    {
+        const unsigned int tileEnd = std::min(_cols, tile + LAYOUT_TILE_SIZE);
+        bool close = true;
+        for (unsigned int row = 0; row < _rows; row++)
+        {
+            for (unsigned int col = tile; col < tileEnd; col++)
+            {
+                close &= isClose(_cell(row, col), other._cell(row, col));
+            }
+        }
+        if (!close)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Returns a checksum of the dimensions and the content of this Matrix.
+ *        The checksum is computed once and cached until the Matrix is changed (any access
+ *        through the non-const operator(), buffer() or an assignment), so equal Matrices
+ *        always have the same checksum, and Matrices with different checksums are different.
+ *        A change through a reference or memory which was taken before the checksum was cached
+ *        is not seen by it (see buffer()).
+ *        Only a Matrix of hashable elements (see ScalarTraits) has a checksum.
+ * @return The checksum of this Matrix.
+ */
+template <class T>
+std::uint64_t Matrix<T>::checksum() const
+{
+    static_assert(ScalarTraits<T>::hashable, "Only a Matrix of hashable elements has a checksum");
+    if (_checksumValid.load(std::memory_order_acquire))
+    {
+        return _checksum.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t checksum = (((std::uint64_t) _rows) << (sizeof(unsigned int) * CHAR_BIT)) |
+                             _cols;
+    for (const T& cell : *this)
+    {
+        checksum = (checksum * HASH_MULTIPLIER) ^ ScalarTraits<T>::hash(cell);
+    }
+    _checksum.store(checksum, std::memory_order_relaxed);
+    _checksumValid.store(true, std::memory_order_release);
+    return checksum;
+}
+
+/**
+ * @brief Perform the Transpose operation on this Matrix.
+ *        This operator does not change this Matrix data.
+ *        The Transpose is a copy of the cells of this Matrix in the opposite layout. In Copy On
+ *        Write mode, the Transpose of an owned Matrix whose cells were not exposed shares it's
+ *        cells, so it takes constant time, and the cells are duplicated only when one of the
+ *        Matrices is changed.
+ * @return A Matrix which represent the result of the Transpose operation.
+ */
+template <class T>
+Matrix<T> Matrix<T>::trans() const
+{
+    Matrix<T> result(EMPTY_MATRIX_SIZE, EMPTY_MATRIX_SIZE);
+    if (_copyOnWriteFlag && _cells.isOwner() && !_cells.isExposed())
+    {
+        _transposeView(*this, result);
+        return result;
+    }
+
+    // The cells are copied as they are stored, and viewed in the opposite layout.
+    _transposeView(*this, result, true);
+    result._cells = _cells.clone();
+    return result;
+}
+
+/**
+ * @brief Perform the Conjugate Transpose operation on this Matrix.
+ *        This operator does not change this Matrix data.
+ *        The cells are conjugated in their storage order, and the conjugated Matrix is viewed
+ *        in the opposite layout.
+ * @return A Matrix which represent the result of the Conjugate Transpose operation.
+ */
+template <>
+inline Matrix<Complex> Matrix<Complex>::trans() const
+{
+    Matrix<Complex> result(EMPTY_MATRIX_SIZE, EMPTY_MATRIX_SIZE);
+    _transposeView(map([](const Complex& cell) { return cell.conj(); }), result);
+    return result;
+}
+
+
+/*-----=  Element-wise Operations & Reductions  =-----*/
+
+
+/**
+ * @brief An operator overload for the multiplication operator '*' with a scalar.
+ *        The operator multiply each cell of this Matrix with the given scalar and return a
+ *        new Matrix which represent the result of the multiplication operation.
+ *        This operator does not change this Matrix data.
+ *        This operator supports multithread mode, where each thread perform the operation
+ *        on a contiguous block of cells in the Matrix.
+ * @param scalar The scalar to multiply this Matrix with.
+ * @return A Matrix which represent the result of the multiplication operation.
+ */
+template <class T>
+Matrix<T> Matrix<T>::operator*(const T& scalar) const
+{
+    std::unique_ptr<Matrix<T>> scratch;
+    const Matrix<T>& matrix = _isDense() ? *this : _packed(*this, scratch);
+    Matrix<T> result(_rows, _cols, matrix.layout());
+    const T *source = matrix._cells.data();
+    T *destination = result._cells.data();
+
+    _parallelFor(_rows * _cols, [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int i = begin; i < end; i++)
+        {
+            destination[i] = source[i] * scalar;
+        }
+    });
+
+    return result;
+}
+
+/**
+ * @brief An operator overload for the multiplication operator '*' of a scalar with a Matrix.
+ *        The operator multiply each cell of the given Matrix with the given scalar.
+ * @param scalar The scalar to multiply the Matrix with.
+ * @param matrix The Matrix to multiply.
+ * @return A Matrix which represent the result of the multiplication operation.
+ */
+template <class T>
+Matrix<T> operator*(const T& scalar, const Matrix<T>& matrix)
+{
+    return matrix.map([&](const T& cell) { return scalar * cell; });
+}
+
+/**
+ * @brief Perform the Hadamard (element-wise) product of this Matrix with the given Matrix.
+ *        This operator does not change this Matrix or the given Matrix data.
+ *        If the dimensions of this Matrix doesn't fit the given Matrix, an Exception will be thrown
+ *        This operator supports multithread mode, where each thread perform the operation
+ *        on a contiguous block of rows (or columns) in the Matrix.
+ * @param other The other Matrix to multiply element-wise with this Matrix.
+ * @return A Matrix which represent the result of the Hadamard product.
+ */
+template <class T>
+Matrix<T> Matrix<T>::hadamard(const Matrix<T>& other) const
+{
+    // If the two Matrices dimensions does not fit for this operation.
+    if (this -> _rows != other._rows || this -> _cols != other._cols)
+    {
+        throw MatrixDimensionsException();
+    }
+
+    return _elementwise(*this, other, [](const T& first, const T& second) -> T
+    {
+        return first * second;
+    });
+}
+
+/**
+ * @brief Apply the given function on each cell of this Matrix and return a new Matrix which
+ *        holds the results.
+ *        This operator does not change this Matrix data.
+ *        In multithread mode the function is called concurrently from several threads, so it
+ *        must be safe to do so.
+ * @param function The function to apply, which receives a cell and returns the new cell.
+ * @return A Matrix which holds the result of the function on each cell.
+ */
+template <class T>
+template <class Function>
+Matrix<T> Matrix<T>::map(Function function) const
+{
+    std::unique_ptr<Matrix<T>> scratch;
+    const Matrix<T>& matrix = _isDense() ? *this : _packed(*this, scratch);
+    Matrix<T> result(_rows, _cols, matrix.layout());
+    const T *source = matrix._cells.data();
+    T *destination = result._cells.data();
+
+    _parallelFor(_rows * _cols, [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int i = begin; i < end; i++)
+        {
+            destination[i] = function(source[i]);
+        }
+    });
+
+    return result;
+}
+
+/**
+ * @brief An Helper Function for the reductions.
+ *        Reduce a non-empty range of cells into a single value, using several independent
+ *        accumulators so the compiler can vectorize the loop.
+ * @param first A pointer to the first cell in the range.
+ * @param count The number of cells in the range (must be positive).
+ * @param transform The function which transforms a cell before the reduction.
+ * @param operation The binary associative operation to reduce the cells with.
+ * @return The reduction of the range.
+ */
+template <class T>
+template <class R, class Iterator, class Transform, class BinaryOperation>
+R Matrix<T>::_reduceRange(Iterator first, unsigned int count, Transform transform,
+                          BinaryOperation operation)
+{
+    assert(count > 0);
+
+    // A short range is not worth splitting between the accumulators.
+    if (count < REDUCTION_LANES)
+    {
+        R accumulator = transform(first[0]);
+        for (unsigned int i = 1; i < count; i++)
+        {
+            accumulator = operation(accumulator, transform(first[i]));
+        }
+        return accumulator;
+    }
+
+    // The accumulators are plain locals and the loop is unrolled by their number, so each
+    // of them stays in a register (or a vector lane) for the whole range.
+    static_assert(REDUCTION_LANES == 4, "The reduction loop is unrolled by REDUCTION_LANES");
+    R lane0 = transform(first[0]);
+    R lane1 = transform(first[1]);
+    R lane2 = transform(first[2]);
+    R lane3 = transform(first[3]);
+    unsigned int i = REDUCTION_LANES;
+    for (; i + REDUCTION_LANES <= count; i += REDUCTION_LANES)
+    {
+        lane0 = operation(lane0, transform(first[i]));
+        lane1 = operation(lane1, transform(first[i + 1]));
+        lane2 = operation(lane2, transform(first[i + 2]));
+        lane3 = operation(lane3, transform(first[i + 3]));
+    }
+
+    // The remaining cells go to the first accumulators, as if the loop went on.
+    if (i < count)
+    {
+        lane0 = operation(lane0, transform(first[i]));
+    }
+    if (i + 1 < count)
+    {
+        lane1 = operation(lane1, transform(first[i + 1]));
+    }
+    if (i + 2 < count)
+    {
+        lane2 = operation(lane2, transform(first[i + 2]));
+    }
+
+    // Combine the accumulators pairwise, in a fixed order.
+    lane0 = operation(lane0, lane2);
+    lane1 = operation(lane1, lane3);
+    return operation(lane0, lane1);
+}
+
+/**
+ * @brief Transform each cell in the Matrix and reduce the results into a single value.
+ *        The cells are reduced in blocks (in parallel mode, each block by a separate thread),
+ *        and the results of the blocks are combined in a tree order.
+ *        The cells are read in place, in the order of their storage if the Matrix is dense and
+ *        the operation is commutative (so the blocks depend on the layout as well), and in row
+ *        order otherwise.
+ * @param init The initial value of the reduction.
+ * @param transform The function which transforms a cell before the reduction.
+ * @param operation The binary associative operation to reduce the cells with.
+ * @param commutative Whether the operation is commutative.
+ * @return The reduction of all the cells in the Matrix.
+ */
+template <class T>
+template <class R, class Transform, class BinaryOperation>
+R Matrix<T>::_transformReduce(const R& init, Transform transform, BinaryOperation operation,
+                              bool commutative) const
+{
+    const unsigned int cellsCount = _rows * _cols;
+    if (cellsCount == EMPTY_MATRIX_SIZE)
+    {
+        return init;
+    }
+
+    // In deterministic mode the blocks depend only on the Matrix size, otherwise each worker
+    // reduces a single block.
+    unsigned int blockSize = REDUCTION_BLOCK_SIZE;
+    if (!_deterministicFlag)
+    {
+        unsigned int workers = _threadFlag ? _workerCount() : 1;
+        blockSize = (cellsCount + workers - 1) / workers;
+    }
+    const unsigned int blocksCount = (cellsCount + blockSize - 1) / blockSize;
+
+    // A view which isn't read in storage order is read through it's strides, without copying.
+    std::vector<R> partials(blocksCount, init);
+    const bool storageOrder = _isPacked() || (commutative && _isDense());
+    const T *cells = _cells.data();
+    const const_iterator rows = begin();
+    _parallelFor(blocksCount, [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int block = begin; block < end; block++)
+        {
+            unsigned int first = block * blockSize;
+            unsigned int count = std::min(blockSize, cellsCount - first);
+            partials[block] = storageOrder ?
+                              _reduceRange<R>(cells + first, count, transform, operation) :
+                              _reduceRange<R>(rows + first, count, transform, operation);
+        }
+    });
+
+    // Combine the results of the blocks pairwise, in a fixed tree order.
+    for (unsigned int width = 1; width < blocksCount; width *= 2)
+    {
+        for (unsigned int block = 0; block + width < blocksCount; block += 2 * width)
+        {
+            partials[block] = operation(partials[block], partials[block + width]);
+        }
+    }
+    return operation(init, partials[0]);
+}
+
+/**
+ * @brief Reduce all the cells in the Matrix into a single value using the given operation.
+ *        The operation must be associative, because the cells are reduced in blocks which are
+ *        combined in a tree order. The given initial value is combined with the result once.
+ *        In deterministic mode the reduction order depends only on the Matrix dimensions, so
+ *        the result is the same in parallel and non-parallel mode.
+ * @param init The initial value of the reduction.
+ * @param operation The binary associative operation to reduce the cells with.
+ * @return The reduction of all the cells in the Matrix.
+ */
+template <class T>
+template <class BinaryOperation>
+T Matrix<T>::reduce(const T& init, BinaryOperation operation) const
+{
+    return _transformReduce<T>(init, [](const T& cell) -> const T& { return cell; }, operation,
+                               false);
+}
+
+/**
+ * @brief Returns the sum of all the cells in the Matrix.
+ *        For an empty Matrix the result is DEFAULT_VALUE.
+ * @return The sum of all the cells in the Matrix.
+ */
+template <class T>
+T Matrix<T>::sum() const
+{
+    return _transformReduce<T>(T(DEFAULT_VALUE), [](const T& cell) -> const T& { return cell; },
+                               std::plus<T>(), true);
+}
+
+/**
+ * @brief Returns the Frobenius Norm of the Matrix, i.e. the square root of the sum of the
+ *        squared magnitudes of all the cells in the Matrix.
+ * @return The Frobenius Norm of the Matrix.
+ */
+template <class T>
+double Matrix<T>::frobeniusNorm() const
+{
+    return std::sqrt(_transformReduce<double>(DEFAULT_VALUE, &ScalarTraits<T>::norm,
+                                              std::plus<double>(), true));
+}
+
+/**
+ * @brief Returns the largest magnitude of a cell in the Matrix.
+ *        For an empty Matrix the result is zero.
+ * @return The largest magnitude of a cell in the Matrix.
+ */
+template <class T>
+double Matrix<T>::maxAbs() const
+{
+    return _transformReduce<double>(DEFAULT_VALUE, &ScalarTraits<T>::abs,
+                                    [](double first, double second)
+                                    {
+                                        return std::max(first, second);
+                                    }, true);
+}
+
+
+/*-----=  Linear Algebra  =-----*/
+
+
+/**
+ * @brief Returns the determinant of this Matrix, computed from it's LU Decomposition.
+ *        Only a Matrix of floating point (or Complex) elements has a determinant.
+ *        If this Matrix is not a square Matrix, an Exception will be thrown.
+ * @return The determinant of this Matrix.
+ */
+template <class T>
+template <class U>
+FloatingResult<U, T> Matrix<T>::det() const
+{
+    return LUDecomposition<T>(*this).det();
+}
+
+/**
+ * @brief Solve the linear system (this * X = b) using the LU Decomposition of this Matrix.
+ *        The given Matrix may have several columns, and each of them is solved separately.
+ *        If this Matrix is not a square Matrix or if it doesn't fit the given Matrix, an
+ *        Exception will be thrown. If this Matrix is singular an Exception will be thrown.
+ * @param b The right hand side of the linear system.
+ * @return The Matrix X which solves the linear system.
+ */
+template <class T>
+template <class U>
+FloatingResult<U, Matrix<T>> Matrix<T>::solve(const Matrix<T>& b) const
+{
+    return LUDecomposition<T>(*this).solve(b);
+}
+
+/**
+ * @brief Returns the inverse of this Matrix, computed from it's LU Decomposition.
+ *        If this Matrix is not a square Matrix or if it is singular, an Exception will be thrown.
+ * @return The inverse of this Matrix.
+ */
+template <class T>
+template <class U>
+FloatingResult<U, Matrix<T>> Matrix<T>::inverse() const
+{
+    return LUDecomposition<T>(*this).inverse();
+}
+
+/**
+ * @brief Returns the identity Matrix of the given size.
+ * @param size The number of rows and columns in the identity Matrix.
+ * @return The identity Matrix of the given size.
+ */
+template <class T>
+Matrix<T> Matrix<T>::identity(unsigned int size)
+{
+    Matrix<T> result(size, size);
+    for (unsigned int i = 0; i < size; i++)
+    {
+        result._cells[(i * size) + i] = T(IDENTITY_VALUE);
+    }
+    return result;
+}
+
+/**
+ * @brief An operator overload for the output stream operator '<<'.
+ *        The operator creates an output format for a Matrix and sets the given output stream
+ *        with it.
+ *        The format of a Matrix output is:
+ *          Each row of the Matrix is in it's own row, and all the cells in the row are separated
+ *          by a single tab.
+ * @param out The output stream to set with the Matrix representation.
+ * @param matrix The Matrix to print to the output stream.
+ * @return An output stream with the Matrix representation.
+ */
+template <class T>
+std::ostream& operator<<(std::ostream& out, const Matrix<T>& matrix)
+{
+    for (unsigned int i = 0; i < matrix._rows; i++)
+    {
+        for (unsigned int j = 0; j < matrix._cols; j++)
+        {
+            out << matrix(i, j) << CELL_SEPARATOR;
+        }
+        out << std::endl;
+    }
+    return out;
+}
+
+/**
+ * @brief An operator overload for the access operation '()'.
+ *        The operator gives access to the element in the Matrix in the given row and column
+ *        by calling the Matrix with the operator as - matrixName(row, col).
+ *        This function returns a const reference to the element in the requested cell, and
+ *        the user can only read the data and cannot change it.
+ *        If one of the given indices to access are invalid, an Exception will be thrown.
+ * @param rowNumber The row number in the Matrix to access.
+ * @param colNumber The column number in the Matrix to access.
+ * @return A read-only access to the element in the given indices in the Matrix.
+ */
+template <class T>
+const T& Matrix<T>::operator()(unsigned int rowNumber, unsigned int colNumber) const
+{
+    // Check that the given indices are in the Matrix boundaries.
+    if (rowNumber >= _rows || colNumber >= _cols)
+    {
+        throw MatrixIndexException();
+    }
+
+    return _cells[((std::size_t) rowNumber * _rowStride) +
+                  ((std::size_t) colNumber * _colStride)];
+}
+
+/**
+ * @brief An operator overload for the access operation '()'.
+ *        The operator gives access to the element in the Matrix in the given row and column
+ *        by calling the Matrix with the operator as - matrixName(row, col).
+ *        This function returns a reference to the element in the requested cell, and
+ *        the user can read the data and also can change it.
+ *        If one of the given indices to access are invalid, an Exception will be thrown.
+ * @param rowNumber The row number in the Matrix to access.
+ * @param colNumber The column number in the Matrix to access.
+ * @return Access to the element in the given indices in the Matrix.
+ */
+template <class T>
+T& Matrix<T>::operator()(unsigned int rowNumber, unsigned int colNumber)
+{
+    // Check that the given indices are in the Matrix boundaries.
+    if (rowNumber >= _rows || colNumber >= _cols)
+    {
+        throw MatrixIndexException();
+    }
+
+    // The returned reference may be used to change the cell at any time.
+    _detach();
+    _cells.expose();
+    _invalidateChecksum(rowNumber, colNumber);
+    return _cells[((std::size_t) rowNumber * _rowStride) +
+                  ((std::size_t) colNumber * _colStride)];
+}
+
+
+/*-----=  Memory Interoperability  =-----*/
+
+
+/**
+ * @brief Returns a description of the memory of this Matrix, so it can be passed to other
+ *        libraries without copying. The cells may be changed through the returned memory
+ *        until the next use of the checksum of this Matrix (a comparison or the result cache),
+ *        which caches the content of that time. To change the cells after it, call buffer()
+ *        again, which forgets the cached checksum.
+ * @return The memory of this Matrix.
+ */
+template <class T>
+MatrixBuffer<T> Matrix<T>::buffer()
+{
+    // The returned memory may be used to change the cells at any time.
+    _detach();
+    _cells.expose();
+    _invalidateChecksum();
+    MatrixBuffer<T> result = {_cells.data(), _rows, _cols, _rowStride, layout()};
+    if (result.layout == COLUMN_MAJOR)
+    {
+        result.stride = (_cols <= 1) ? _rows : _colStride;
+    }
+    else if (_rows <= 1)
+    {
+        result.stride = _cols;
+    }
+    return result;
+}
+
+/**
+ * @brief Returns a read-only description of the memory of this Matrix.
+ * @return The memory of this Matrix.
+ */
+template <class T>
+MatrixBuffer<const T> Matrix<T>::buffer() const
+{
+    MatrixBuffer<const T> result = {_cells.data(), _rows, _cols, _rowStride, layout()};
+    if (result.layout == COLUMN_MAJOR)
+    {
+        result.stride = (_cols <= 1) ? _rows : _colStride;
+    }
+    else if (_rows <= 1)
+    {
+        result.stride = _cols;
     }
+    return result;
+}
 
-    return _cells[(rowNumber * _cols) + colNumber];
+/**
+ * @brief Returns the order of the cells of this Matrix in the memory.
+ *        A Matrix with a single row (or column) may be viewed in both layouts, and is reported
+ *        to be in row order, unless it is a single row of a Matrix in column order.
+ * @return The order of the cells of this Matrix in the memory.
+ */
+template <class T>
+MatrixLayout Matrix<T>::layout() const
+{
+    if (_colStride == 1 && (_rows <= 1 || _rowStride >= _cols))
+    {
+        return ROW_MAJOR;
+    }
+    return COLUMN_MAJOR;
 }
 
 /**
- * @brief An operator overload for the access operation '()'.
- *        The operator gives access to the element in the Matrix in the given row and column
- *        by calling the Matrix with the operator as - matrixName(row, col).
- *        This function returns a reference to the element in the requested cell, and
- *        the user can read the data and also can change it.
- *        If one of the given indices to access are invalid, an Exception will be thrown.
- * @param rowNumber The row number in the Matrix to access.
- * @param colNumber The column number in the Matrix to access.
- * @return Access to the element in the given indices in the Matrix.
+ * @brief Returns the given Matrix if it's cells are packed in row order, otherwise packs a
+ *        copy of it into the given scratch Matrix and returns the scratch Matrix.
+ * @param matrix The Matrix to read.
+ * @param scratch The Matrix which holds the packed copy, if one is needed.
+ * @return A Matrix with the cells of the given Matrix, packed in row order.
  */
 template <class T>
-T& Matrix<T>::operator()(unsigned int rowNumber, unsigned int colNumber)
+const Matrix<T>& Matrix<T>::_packed(const Matrix<T>& matrix,
+                                    std::unique_ptr<Matrix<T>>& scratch)
 {
-    // Check that the given indices are in the Matrix boundaries.
-    if (rowNumber >= _rows || colNumber >= _cols)
+    if (matrix._isPacked())
     {
-        throw MatrixIndexException();
+        return matrix;
+    }
+    scratch.reset(new Matrix<T>(matrix));
+    return *scratch;
+}
+
+/**
+ * @brief Sets the given view to the Transpose of the given Matrix, sharing it's cells in the
+ *        opposite layout.
+ * @param matrix The Matrix to transpose.
+ * @param view The Matrix which is set to the transposed view.
+ */
+template <class T>
+void Matrix<T>::_transposeView(const Matrix<T>& matrix, Matrix<T>& view, bool borrow)
+{
+    view._rows = matrix._cols;
+    view._cols = matrix._rows;
+    if (borrow)
+    {
+        view._cells = MatrixStorage<T>(const_cast<T *>(matrix._cells.data()),
+                                       matrix._cells.size());
+    }
+    else
+    {
+        view._cells = matrix._cells;
+    }
+    view._rowStride = matrix._colStride;
+    view._colStride = matrix._rowStride;
+    view._invalidateChecksum();
+}
+
+/**
+ * @brief Sets the given view to the given Matrix, sharing it's cells and it's checksum.
+ * @param matrix The Matrix to share.
+ * @param view The Matrix which is set to the shared view.
+ */
+template <class T>
+void Matrix<T>::_share(const Matrix<T>& matrix, Matrix<T>& view)
+{
+    view._rows = matrix._rows;
+    view._cols = matrix._cols;
+    view._cells = matrix._cells;
+    view._rowStride = matrix._rowStride;
+    view._colStride = matrix._colStride;
+    view._invalidateChecksum();
+    if (matrix._checksumValid.load(std::memory_order_acquire))
+    {
+        view._checksum.store(matrix._checksum.load(std::memory_order_relaxed),
+                             std::memory_order_relaxed);
+        view._checksumValid.store(true, std::memory_order_release);
+    }
+}
+
+/**
+ * @brief Copy the cells of the given Matrix, which are packed in row order, into the cells
+ *        of this Matrix (in it's own layout), so the friends can work in place on a packed
+ *        copy of an adopted Matrix.
+ * @param packed The Matrix with the same dimensions to copy the cells from.
+ */
+template <class T>
+void Matrix<T>::_unpack(const Matrix<T>& packed)
+{
+    assert(packed._isPacked() && packed._rows == _rows && packed._cols == _cols);
+    _detach();
+    _invalidateChecksum();
+    for (unsigned int row = 0; row < _rows; row++)
+    {
+        for (unsigned int col = 0; col < _cols; col++)
+        {
+            _cells[((std::size_t) row * _rowStride) + ((std::size_t) col * _colStride)] =
+                    packed._cells[((std::size_t) row * _cols) + col];
+        }
+    }
+}
+
+/**
+ * @brief Returns the given memory of std::complex<double> cells as memory of Complex cells,
+ *        which have the same layout, so it can be adopted by a Matrix without converting it.
+ * @param buffer The memory of std::complex<double> cells.
+ * @return The same memory, as Complex cells.
+ */
+inline MatrixBuffer<Complex> asComplex(const MatrixBuffer<std::complex<double>>& buffer)
+{
+    MatrixBuffer<Complex> result = {reinterpret_cast<Complex *>(buffer.data), buffer.rows,
+                                    buffer.cols, buffer.stride, buffer.layout};
+    return result;
+}
+
+/**
+ * @brief Returns the given memory of Complex cells (e.g. of a Matrix) as memory of
+ *        std::complex<double> cells, which have the same layout, without converting it.
+ * @param buffer The memory of Complex cells.
+ * @return The same memory, as std::complex<double> cells.
+ */
+inline MatrixBuffer<std::complex<double>> asStdComplex(const MatrixBuffer<Complex>& buffer)
+{
+    MatrixBuffer<std::complex<double>> result = {
+            reinterpret_cast<std::complex<double> *>(buffer.data), buffer.rows, buffer.cols,
+            buffer.stride, buffer.layout};
+    return result;
+}
+
+/**
+ * @brief Returns the given read-only memory of Complex cells as read-only memory of
+ *        std::complex<double> cells, without converting it.
+ * @param buffer The read-only memory of Complex cells.
+ * @return The same memory, as std::complex<double> cells.
+ */
+inline MatrixBuffer<const std::complex<double>> asStdComplex(
+        const MatrixBuffer<const Complex>& buffer)
+{
+    MatrixBuffer<const std::complex<double>> result = {
+            reinterpret_cast<const std::complex<double> *>(buffer.data), buffer.rows,
+            buffer.cols, buffer.stride, buffer.layout};
+    return result;
+}
+
+
+/*-----=  Change Tracking  =-----*/
+
+
+/**
+ * @brief Sets the tracking of the changes of this Matrix to be on or off by the given
+ *        parameter. Turning the tracking on clears the recorded changes.
+ * @param trackingFlag The requested state of the tracking.
+ */
+template <class T>
+void Matrix<T>::setChangeTracking(const bool trackingFlag)
+{
+    if (trackingFlag)
+    {
+        _changes.reset(new MatrixChanges(_rows, _cols));
+    }
+    else
+    {
+        _changes.reset();
+    }
+}
+
+/**
+ * @brief Returns the rows which were changed since the changes were last cleared.
+ *        If the changes are not tracked, all the rows are returned.
+ * @return The changed rows, in increasing order.
+ */
+template <class T>
+std::vector<unsigned int> Matrix<T>::changedRows() const
+{
+    if (_changes)
+    {
+        return _changes -> rows(_rows);
+    }
+    MatrixChanges all(EMPTY_MATRIX_SIZE, EMPTY_MATRIX_SIZE);
+    all.markAll();
+    return all.rows(_rows);
+}
+
+/**
+ * @brief Returns the columns which were changed since the changes were last cleared.
+ *        If the changes are not tracked, all the columns are returned.
+ * @return The changed columns, in increasing order.
+ */
+template <class T>
+std::vector<unsigned int> Matrix<T>::changedCols() const
+{
+    if (_changes)
+    {
+        return _changes -> cols(_cols);
+    }
+    MatrixChanges all(EMPTY_MATRIX_SIZE, EMPTY_MATRIX_SIZE);
+    all.markAll();
+    return all.cols(_cols);
+}
+
+/**
+ * @brief Clear the recorded changes of this Matrix, if they are tracked.
+ */
+template <class T>
+void Matrix<T>::clearChanges()
+{
+    if (_changes)
+    {
+        _changes -> clear(_rows, _cols);
+    }
+}
+
+
+/*-----=  Matrix Functions  =-----*/
+
+
+/**
+ * @brief Raise the given square Matrix to the given power, using exponentiation by squaring.
+ *        The products are computed into two scratch buffers which are reused between the steps,
+ *        so only a constant number of Matrices is allocated regardless of the exponent.
+ *        The products are exact, they ignore the Mixed Precision and the Gauss Multiplication
+ *        Flags.
+ *        If the given Matrix is not a square Matrix, an Exception will be thrown.
+ * @param matrix The Matrix to raise.
+ * @param exponent The power to raise the Matrix to (zero gives the identity Matrix).
+ * @return The given Matrix raised to the given power.
+ */
+template <class T>
+Matrix<T> pow(const Matrix<T>& matrix, unsigned int exponent)
+{
+    if (!matrix.isSquareMatrix())
+    {
+        throw MatrixDimensionsException();
+    }
+    const unsigned int size = matrix._rows;
+    if (exponent == 0)
+    {
+        return Matrix<T>::identity(size);
+    }
+
+    // The result is multiplied by the current square of the base for each set bit of the
+    // exponent. Each product is written to the scratch buffer, which is then swapped in.
+    Matrix<T> base(matrix);
+    Matrix<T> result(size, size);
+    Matrix<T> scratch(size, size);
+    bool hasResult = false;
+    while (true)
+    {
+        if (exponent & 1)
+        {
+            if (hasResult)
+            {
+                Matrix<T>::_multiply(scratch, result, base, true);
+                result._swapMatrix(result, scratch);
+            }
+            else
+            {
+                std::copy(base._cells.begin(), base._cells.end(), result._cells.begin());
+                hasResult = true;
+            }
+        }
+        exponent >>= 1;
+        if (exponent == 0)
+        {
+            break;
+        }
+        Matrix<T>::_multiply(scratch, base, base, true);
+        base._swapMatrix(base, scratch);
+    }
+    return result;
+}
+
+/**
+ * @brief Returns the exponential of the given square Matrix (of doubles or Complex numbers),
+ *        using the scaling and squaring method with a diagonal Pade approximant.
+ *        The powers and the squarings are computed into reused scratch buffers, and they
+ *        ignore the Mixed Precision and the Gauss Multiplication Flags.
+ *        Only a Matrix of floating point (or Complex) elements has an exponential.
+ *        If the given Matrix is not a square Matrix, an Exception will be thrown.
+ * @param matrix The Matrix to exponentiate.
+ * @return The exponential of the given Matrix.
+ */
+template <class T>
+FloatingResult<T, Matrix<T>> matrixExp(const Matrix<T>& matrix)
+{
+    if (!matrix.isSquareMatrix())
+    {
+        throw MatrixDimensionsException();
+    }
+    const unsigned int size = matrix._rows;
+    const unsigned int cellsCount = size * size;
+
+    // Scale the Matrix by a power of two, so it's norm is small enough for the approximant.
+    int squarings = 0;
+    double norm = matrix.frobeniusNorm();
+    if (norm > EXP_SCALING_THRESHOLD)
+    {
+        squarings = (int) std::ceil(std::log2(norm / EXP_SCALING_THRESHOLD));
+    }
+    const Matrix<T> scaled = matrix * T(std::ldexp(IDENTITY_VALUE, -squarings));
+
+    // Accumulate the numerator N(X) and the denominator N(-X) of the Pade approximant.
+    Matrix<T> numerator = Matrix<T>::identity(size);
+    Matrix<T> denominator = Matrix<T>::identity(size);
+    Matrix<T> power(scaled);
+    Matrix<T> scratch(size, size);
+    double coefficient = IDENTITY_VALUE;
+    for (unsigned int k = 1; k <= PADE_DEGREE; k++)
+    {
+        if (k > 1)
+        {
+            Matrix<T>::_multiply(scratch, scaled, power, true);
+            power._swapMatrix(power, scratch);
+        }
+        coefficient *= (double) (PADE_DEGREE - k + 1) / (k * ((2 * PADE_DEGREE) - k + 1));
+        const T numeratorCoefficient(coefficient);
+        const T denominatorCoefficient((k % 2 == 0) ? coefficient : -coefficient);
+        for (unsigned int i = 0; i < cellsCount; i++)
+        {
+            numerator._cells[i] += numeratorCoefficient * power._cells[i];
+            denominator._cells[i] += denominatorCoefficient * power._cells[i];
+        }
+    }
+
+    // Undo the scaling by repeated squaring.
+    Matrix<T> result = LUDecomposition<T>(denominator).solve(numerator);
+    for (int i = 0; i < squarings; i++)
+    {
+        Matrix<T>::_multiply(scratch, result, result, true);
+        result._swapMatrix(result, scratch);
+    }
+    return result;
+}
+
+/**
+ * @brief Find the order of a chain of multiplications which performs the least scalar
+ *        multiplications, by the classic matrix-chain dynamic programming.
+ * @param dimensions The dimensions of the chain, where factor i has dimensions[i] rows and
+ *        dimensions[i + 1] columns.
+ * @param split Set to the split of every sub-chain: split[i][j] is the last factor of the left
+ *        part of the product of factors i..j.
+ * @return The number of scalar multiplications in the optimal order.
+ */
+inline double matrixChainOrder(const std::vector<double>& dimensions,
+                               std::vector<std::vector<unsigned int>>& split)
+{
+    assert(!dimensions.empty());
+    const unsigned int count = (unsigned int) dimensions.size() - 1;
+
+    // cost[i][j] is the least cost of the product of factors i..j.
+    std::vector<std::vector<double>> cost(count, std::vector<double>(count, 0));
+    split.assign(count, std::vector<unsigned int>(count, 0));
+    for (unsigned int length = 2; length <= count; length++)
+    {
+        for (unsigned int i = 0; i + length <= count; i++)
+        {
+            unsigned int j = i + length - 1;
+            cost[i][j] = std::numeric_limits<double>::infinity();
+            for (unsigned int k = i; k < j; k++)
+            {
+                double candidate = cost[i][k] + cost[k + 1][j] +
+                                   dimensions[i] * dimensions[k + 1] * dimensions[j + 1];
+                if (candidate < cost[i][j])
+                {
+                    cost[i][j] = candidate;
+                    split[i][j] = k;
+                }
+            }
+        }
+    }
+    return (count == 0) ? 0 : cost[0][count - 1];
+}
+
+/**
+ * @brief Returns the product of the given chain of Matrices, multiplied in the order which
+ *        performs the least scalar multiplications for their dimensions.
+ *        The intermediate products are computed into scratch buffers which are reused between
+ *        the steps. If the chain is empty or the dimensions doesn't fit, an Exception will be
+ *        thrown.
+ * @param factors The Matrices to multiply, from left to right.
+ * @param cost If not null, set to the estimated cost of the naive and the optimal orders.
+ * @return The product of the chain.
+ */
+template <class T>
+Matrix<T> multiplyChain(const std::vector<const Matrix<T>*>& factors, MatrixChainCost *cost)
+{
+    if (factors.empty())
+    {
+        throw MatrixDimensionsException();
+    }
+    const unsigned int count = (unsigned int) factors.size();
+    std::vector<double> dimensions(1, factors[0] -> _rows);
+    for (unsigned int i = 0; i < count; i++)
+    {
+        if (factors[i] -> _rows != dimensions.back())
+        {
+            throw MatrixDimensionsException();
+        }
+        dimensions.push_back(factors[i] -> _cols);
+    }
+
+    std::vector<std::vector<unsigned int>> split;
+    double optimal = matrixChainOrder(dimensions, split);
+    if (cost != nullptr)
+    {
+        cost -> naiveFlops = 0;
+        for (unsigned int i = 1; i < count; i++)
+        {
+            cost -> naiveFlops += FLOPS_PER_PRODUCT * dimensions[0] * dimensions[i] *
+                                  dimensions[i + 1];
+        }
+        cost -> optimalFlops = FLOPS_PER_PRODUCT * optimal;
+    }
+    if (count == 1)
+    {
+        return *factors[0];
+    }
+
+    // The product of every split is computed into a scratch buffer, which is reshaped to the
+    // dimensions of the product (keeping it's memory) and returned after it was multiplied.
+    std::vector<Matrix<T>> buffers(count - 1, Matrix<T>(EMPTY_MATRIX_SIZE, EMPTY_MATRIX_SIZE));
+    std::vector<unsigned int> freeBuffers;
+    for (unsigned int buffer = 0; buffer < count - 1; buffer++)
+    {
+        freeBuffers.push_back(buffer);
+    }
+
+    // Each step is a sub-chain (i, j) and the operands of it's product, or NO_BUFFER for a
+    // factor of the chain. The steps are performed after both of their operands.
+    std::function<unsigned int(unsigned int, unsigned int)> product =
+            [&](unsigned int i, unsigned int j) -> unsigned int
+    {
+        if (i == j)
+        {
+            return NO_BUFFER;
+        }
+        unsigned int k = split[i][j];
+        unsigned int left = product(i, k);
+        unsigned int right = product(k + 1, j);
+
+        unsigned int result = freeBuffers.back();
+        freeBuffers.pop_back();
+        Matrix<T>& buffer = buffers[result];
+        buffer._rows = (unsigned int) dimensions[i];
+        buffer._cols = (unsigned int) dimensions[j + 1];
+        buffer._cells.resize(buffer._rows * buffer._cols);
+        buffer._rowStride = buffer._cols;
+        Matrix<T>::_multiply(buffer, (left == NO_BUFFER) ? *factors[i] : buffers[left],
+                             (right == NO_BUFFER) ? *factors[j] : buffers[right]);
+
+        for (unsigned int operand : {left, right})
+        {
+            if (operand != NO_BUFFER)
+            {
+                freeBuffers.push_back(operand);
+            }
+        }
+        return result;
+    };
+
+    Matrix<T> result;
+    result._swapMatrix(result, buffers[product(0, count - 1)]);
+    return result;
+}
+
+/**
+ * @brief Returns the product of the given chain of Matrices (e.g. multiplyChain<double>({A, B,
+ *        C})), multiplied in the order which performs the least scalar multiplications for their
+ *        dimensions. The Matrices are taken by reference, so they are not copied. If the chain
+ *        is empty or the dimensions doesn't fit, an Exception will be thrown.
+ * @param factors The Matrices to multiply, from left to right.
+ * @param cost If not null, set to the estimated cost of the naive and the optimal orders.
+ * @return The product of the chain.
+ */
+template <class T>
+Matrix<T> multiplyChain(std::initializer_list<std::reference_wrapper<const Matrix<T>>> factors,
+                        MatrixChainCost *cost)
+{
+    std::vector<const Matrix<T>*> pointers;
+    for (const Matrix<T>& factor : factors)
+    {
+        pointers.push_back(&factor);
     }
+    return multiplyChain(pointers, cost);
+}
 
-    return _cells[(rowNumber * _cols) + colNumber];
+/**
+ * @brief Returns the product of the given Matrices (e.g. multiplyChain(A, B, C)), multiplied in
+ *        the order which performs the least scalar multiplications for their dimensions.
+ *        The Matrices are taken by reference, so they are not copied, and the element type is
+ *        deduced from them. If the dimensions doesn't fit, an Exception will be thrown.
+ * @param first The first Matrix to multiply (on the left side).
+ * @param rest The other Matrices to multiply, from left to right.
+ * @return The product of the chain.
+ */
+template <class T, class... Rest>
+Matrix<T> multiplyChain(const Matrix<T>& first, const Rest&... rest)
+{
+    const std::vector<const Matrix<T>*> pointers{&first, &rest...};
+    return multiplyChain(pointers);
 }
 
 
@@ -571,4 +2559,152 @@ void Matrix<T>::setParallel(const bool threadFlag)
     }
 }
 
+/**
+ * @brief Returns the number of worker threads to use in parallel mode.
+ * @return The number of worker threads.
+ */
+template <class T>
+unsigned int Matrix<T>::_workerCount()
+{
+    if (_workerSetting != ALL_CORES)
+    {
+        return _workerSetting;
+    }
+    unsigned int cores = std::thread::hardware_concurrency();
+    return (cores == 0) ? DEFAULT_WORKER_COUNT : cores;
+}
+
+/**
+ * @brief Perform the given task on the range [0, count).
+ *        In parallel mode the range is split into contiguous blocks, and each block is
+ *        performed by a separate thread (pinned to it's core if the Affinity Flag is on).
+ *        If the Work Stealing Flag is on, the range is performed by the workers of the
+ *        Matrix Scheduler instead, which split it recursively and steal blocks from each other.
+ *        In non-parallel mode, or in a block of the Matrix Scheduler, the whole range is
+ *        performed by the calling thread.
+ * @param count The size of the range.
+ * @param task The task to perform, which receives the beginning and the end of a block.
+ */
+template <class T>
+template <class Function>
+void Matrix<T>::_parallelFor(unsigned int count, Function task)
+{
+    unsigned int workers = _threadFlag ? std::min(count, _workerCount()) : 1;
+    if (workers <= 1 || MatrixScheduler::isWorker())
+    {
+        task(0, count);
+        return;
+    }
+    if (_workStealingFlag)
+    {
+        MatrixScheduler::shared().run(count, workers, std::ref(task));
+        return;
+    }
+
+    // Split the range into blocks which differ in size by at most one.
+    std::vector<std::thread> blockThreads;
+    unsigned int blockSize = count / workers;
+    unsigned int remainder = count % workers;
+    unsigned int begin = 0;
+    for (unsigned int worker = 0; worker < workers; worker++)
+    {
+        unsigned int end = begin + blockSize + ((worker < remainder) ? 1 : 0);
+        blockThreads.push_back(std::thread([&task, worker, begin, end]()
+        {
+            if (_affinityFlag)
+            {
+                const std::vector<unsigned int>& cpus = MatrixTopology::system().workerCpus();
+                MatrixTopology::pinCurrentThread(cpus[worker % cpus.size()]);
+            }
+            task(begin, end);
+        }));
+        begin = end;
+    }
+    for (std::thread& thread : blockThreads)
+    {
+        thread.join();
+    }
+}
+
+/**
+ * @brief Returns the beginning of the given block, when a range is split into the given number
+ *        of blocks which differ in size by at most one (the larger blocks first, as in
+ *        _parallelFor).
+ * @param count The size of the range.
+ * @param blocks The number of blocks.
+ * @param block The block, or the number of blocks for the end of the range.
+ * @return The beginning of the block.
+ */
+template <class T>
+unsigned int Matrix<T>::_blockBegin(unsigned int count, unsigned int blocks, unsigned int block)
+{
+    return (block * (count / blocks)) + std::min(block, count % blocks);
+}
+
+/**
+ * @brief Perform the given task on the grid [0, rows) x [0, cols).
+ *        In parallel mode the grid is split into at most one tile per worker: the rows are
+ *        split into contiguous blocks as in _parallelFor, and if there are fewer rows than
+ *        workers, each block of rows is also split into blocks of columns. So a grid with
+ *        enough rows is processed in the same blocks of rows as by _parallelFor, and a short
+ *        and wide grid still keeps all the workers busy. If the Work Stealing Flag is on, the
+ *        grid is split into STEAL_SPLIT_FACTOR tiles per worker instead.
+ *        In non-parallel mode the whole grid is performed by the calling thread.
+ * @param rows The number of rows in the grid.
+ * @param cols The number of columns in the grid.
+ * @param task The task to perform, which receives the beginning and the end of the rows and
+ *        of the columns of a tile.
+ */
+template <class T>
+template <class Function>
+void Matrix<T>::_parallelGrid(unsigned int rows, unsigned int cols, Function task)
+{
+    // The Matrix Scheduler balances the workers by itself, given enough tiles to move.
+    unsigned int tiles = _threadFlag ? _workerCount() : 1;
+    if (_workStealingFlag)
+    {
+        tiles *= STEAL_SPLIT_FACTOR;
+    }
+    const unsigned int rowBlocks = std::max(1u, std::min(rows, tiles));
+    const unsigned int colBlocks = std::max(1u, std::min(cols, tiles / rowBlocks));
+    _parallelFor(rowBlocks * colBlocks, [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int tile = begin; tile < end; tile++)
+        {
+            const unsigned int rowBlock = tile / colBlocks;
+            const unsigned int colBlock = tile % colBlocks;
+            task(_blockBegin(rows, rowBlocks, rowBlock),
+                 _blockBegin(rows, rowBlocks, rowBlock + 1),
+                 _blockBegin(cols, colBlocks, colBlock),
+                 _blockBegin(cols, colBlocks, colBlock + 1));
+        }
+    });
+}
+
+
+/*-----=  Matrix Extensions  =-----*/
+
+
+// Included last, so the definitions above are visible whichever header was included first.
+#include "MatrixDecomposition.h"
+#include "MatrixAsync.h"
+#include "MatrixProduct.h"
+#include "MatrixCache.h"
+
+
+/*-----=  Precompiled Instances  =-----*/
+
+
+// The Matrices of the standard element types are compiled once, in the Matrix Library (see
+// MatrixInstances.cpp), and a program which links it defines MATRIX_PRECOMPILED so it doesn't
+// compile them again. The Matrices of other element types are compiled from the headers.
+#ifdef MATRIX_PRECOMPILED
+extern template class Matrix<int>;
+extern template class Matrix<double>;
+extern template class Matrix<Complex>;
+extern template class MatrixCache<int>;
+extern template class MatrixCache<double>;
+extern template class MatrixCache<Complex>;
+#endif
+
 #endif
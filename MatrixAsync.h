@@ -0,0 +1,167 @@
+/**
+ * @file MatrixAsync.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 18 Oct 2026
+ *
+ * @brief A Header File for the Matrix Future Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the Matrix Future Class.
+ * A Matrix Future holds the result of an asynchronous Matrix operation, which is performed by
+ * the shared Matrix Thread Pool. An operation may depend on the Futures of other operations,
+ * and it is submitted to the pool only when all of them are ready, so a graph of operations
+ * runs without blocking the caller or the workers of the pool.
+ * An Exception which is thrown by an operation is kept in it's Future, is thrown again by get(),
+ * and is passed on to all the operations which depend on it.
+ */
+
+
+#ifndef _MATRIXASYNC_H
+#define _MATRIXASYNC_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include "Matrix.h"
+#include "MatrixThreadPool.h"
+
+
+/*-----=  Class Definition  =-----*/
+
+
+/**
+ * @brief A Class representing the result of an asynchronous Matrix operation.
+ *        Copies of a Future share the same result.
+ */
+template <class T>
+class MatrixFuture
+{
+public:
+
+    /**
+     * @brief A Constructor for a Future which is already ready with (a copy of) the given
+     *        Matrix, so a Matrix can be given wherever a Future is expected.
+     * @param matrix The Matrix which is the result of the Future.
+     */
+    MatrixFuture(const Matrix<T>& matrix);
+
+    /**
+     * @brief A Constructor for a Future which is already ready with the given temporary
+     *        Matrix, which is swapped in without copying it's cells.
+     * @param matrix The Matrix which is the result of the Future.
+     */
+    MatrixFuture(Matrix<T>&& matrix);
+
+    /**
+     * @brief Returns a Future for the result of the given task, which is performed by the
+     *        shared Matrix Thread Pool after all the given dependencies are ready.
+     *        The task may read the results of the dependencies with get() without blocking.
+     * @param dependencies The Futures which the task depends on.
+     * @param task The task which computes the result.
+     * @return A Future for the result of the task.
+     */
+    static MatrixFuture<T> after(const std::vector<MatrixFuture<T>>& dependencies,
+                                 std::function<Matrix<T>()> task);
+
+    /**
+     * @brief Returns true if the result is ready (or the operation has failed).
+     * @return true if the result is ready, false otherwise.
+     */
+    bool ready() const;
+
+    /**
+     * @brief Block until the result is ready (or the operation has failed).
+     */
+    void wait() const;
+
+    /**
+     * @brief Block until the result is ready and return it.
+     *        If the operation (or one of it's dependencies) has thrown an Exception, the
+     *        Exception is thrown again.
+     * @return The result of the operation.
+     */
+    const Matrix<T>& get() const;
+
+private:
+
+    /**
+     * @brief The state which is shared by the copies of a Future.
+     */
+    struct _State
+    {
+        /**
+         * @brief A mutex which guards the state.
+         */
+        std::mutex mutex;
+
+        /**
+         * @brief A condition which is notified when the result is ready.
+         */
+        std::condition_variable done;
+
+        /**
+         * @brief A flag which determine if the result is ready.
+         */
+        bool ready = false;
+
+        /**
+         * @brief The result of the operation.
+         */
+        Matrix<T> value;
+
+        /**
+         * @brief The Exception which was thrown by the operation, if any.
+         */
+        std::exception_ptr error;
+
+        /**
+         * @brief The functions to call when the result is ready.
+         */
+        std::vector<std::function<void()>> continuations;
+    };
+
+    /**
+     * @brief The state of this Future.
+     */
+    std::shared_ptr<_State> _state;
+
+    /**
+     * @brief A Constructor for a Future which is not ready yet.
+     * @param state The state of the Future.
+     */
+    explicit MatrixFuture(const std::shared_ptr<_State>& state);
+
+    /**
+     * @brief Perform the given task and make it's result (or Exception) the result of the
+     *        given state, then call the continuations of the state.
+     * @param state The state which holds the result.
+     * @param task The task which computes the result.
+     */
+    static void _complete(const std::shared_ptr<_State>& state,
+                          const std::function<Matrix<T>()>& task);
+
+    /**
+     * @brief Call the given function when the result of the given state is ready (immediately
+     *        if it is already ready).
+     * @param state The state to wait for.
+     * @param continuation The function to call.
+     */
+    static void _onReady(const std::shared_ptr<_State>& state,
+                         const std::function<void()>& continuation);
+};
+
+
+#include "MatrixAsync.hpp"
+
+#endif
@@ -0,0 +1,257 @@
+/**
+ * @file MatrixAsync.hpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 18 Oct 2026
+ *
+ * @brief An implementation of the Matrix Future Class and the asynchronous Matrix operations.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * An implementation of the Matrix Future Class and the asynchronous Matrix operations.
+ * Each operation counts it's dependencies which are not ready yet, and the last dependency to
+ * become ready submits the operation to the pool. Therefore a worker never waits for another
+ * operation, and the pool cannot deadlock regardless of the shape of the graph.
+ */
+
+
+#ifndef _MATRIXASYNC_HPP
+#define _MATRIXASYNC_HPP
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <atomic>
+#include "MatrixAsync.h"
+
+
+/*-----=  Constructors  =-----*/
+
+
+/**
+ * @brief A Constructor for a Future which is already ready with (a copy of) the given
+ *        Matrix, so a Matrix can be given wherever a Future is expected.
+ * @param matrix The Matrix which is the result of the Future.
+ */
+template <class T>
+MatrixFuture<T>::MatrixFuture(const Matrix<T>& matrix) : _state(std::make_shared<_State>())
+{
+    _state -> value = matrix;
+    _state -> ready = true;
+}
+
+/**
+ * @brief A Constructor for a Future which is already ready with the given temporary Matrix,
+ *        which is swapped in without copying it's cells.
+ * @param matrix The Matrix which is the result of the Future.
+ */
+template <class T>
+MatrixFuture<T>::MatrixFuture(Matrix<T>&& matrix) : _state(std::make_shared<_State>())
+{
+    _state -> value._swapMatrix(_state -> value, matrix);
+    _state -> ready = true;
+}
+
+/**
+ * @brief A Constructor for a Future which is not ready yet.
+ * @param state The state of the Future.
+ */
+template <class T>
+MatrixFuture<T>::MatrixFuture(const std::shared_ptr<_State>& state) : _state(state)
+{
+
+}
+
+
+/*-----=  Future Methods  =-----*/
+
+
+/**
+ * @brief Returns a Future for the result of the given task, which is performed by the
+ *        shared Matrix Thread Pool after all the given dependencies are ready.
+ *        The task may read the results of the dependencies with get() without blocking.
+ * @param dependencies The Futures which the task depends on.
+ * @param task The task which computes the result.
+ * @return A Future for the result of the task.
+ */
+template <class T>
+MatrixFuture<T> MatrixFuture<T>::after(const std::vector<MatrixFuture<T>>& dependencies,
+                                       std::function<Matrix<T>()> task)
+{
+    std::shared_ptr<_State> state = std::make_shared<_State>();
+
+    // The extra count is released after all the dependencies are registered, so the task
+    // cannot be submitted while it is still being registered.
+    std::shared_ptr<std::atomic<unsigned int>> pending =
+            std::make_shared<std::atomic<unsigned int>>((unsigned int) dependencies.size() + 1);
+    std::function<void()> release = [state, task, pending]()
+    {
+        if (--(*pending) == 0)
+        {
+            MatrixThreadPool::shared().submit([state, task]() { _complete(state, task); });
+        }
+    };
+
+    for (const MatrixFuture<T>& dependency : dependencies)
+    {
+        _onReady(dependency._state, release);
+    }
+    release();
+
+    return MatrixFuture<T>(state);
+}
+
+/**
+ * @brief Returns true if the result is ready (or the operation has failed).
+ * @return true if the result is ready, false otherwise.
+ */
+template <class T>
+bool MatrixFuture<T>::ready() const
+{
+    std::lock_guard<std::mutex> lock(_state -> mutex);
+    return _state -> ready;
+}
+
+/**
+ * @brief Block until the result is ready (or the operation has failed).
+ */
+template <class T>
+void MatrixFuture<T>::wait() const
+{
+    std::unique_lock<std::mutex> lock(_state -> mutex);
+    _state -> done.wait(lock, [this]() { return _state -> ready; });
+}
+
+/**
+ * @brief Block until the result is ready and return it.
+ *        If the operation (or one of it's dependencies) has thrown an Exception, the
+ *        Exception is thrown again.
+ * @return The result of the operation.
+ */
+template <class T>
+const Matrix<T>& MatrixFuture<T>::get() const
+{
+    wait();
+    if (_state -> error)
+    {
+        std::rethrow_exception(_state -> error);
+    }
+    return _state -> value;
+}
+
+/**
+ * @brief Perform the given task and make it's result (or Exception) the result of the
+ *        given state, then call the continuations of the state.
+ * @param state The state which holds the result.
+ * @param task The task which computes the result.
+ */
+template <class T>
+void MatrixFuture<T>::_complete(const std::shared_ptr<_State>& state,
+                                const std::function<Matrix<T>()>& task)
+{
+    Matrix<T> value;
+    std::exception_ptr error;
+    try
+    {
+        Matrix<T> result = task();
+        value._swapMatrix(value, result);
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+
+    std::vector<std::function<void()>> continuations;
+    {
+        std::lock_guard<std::mutex> lock(state -> mutex);
+        // The result is swapped in, so no cells are copied while the mutex is held.
+        state -> value._swapMatrix(state -> value, value);
+        state -> error = error;
+        state -> ready = true;
+        continuations.swap(state -> continuations);
+    }
+    state -> done.notify_all();
+
+    for (const std::function<void()>& continuation : continuations)
+    {
+        continuation();
+    }
+}
+
+/**
+ * @brief Call the given function when the result of the given state is ready (immediately
+ *        if it is already ready).
+ * @param state The state to wait for.
+ * @param continuation The function to call.
+ */
+template <class T>
+void MatrixFuture<T>::_onReady(const std::shared_ptr<_State>& state,
+                               const std::function<void()>& continuation)
+{
+    {
+        std::lock_guard<std::mutex> lock(state -> mutex);
+        if (!state -> ready)
+        {
+            state -> continuations.push_back(continuation);
+            return;
+        }
+    }
+    continuation();
+}
+
+
+/*-----=  Asynchronous Matrix Operations  =-----*/
+
+
+/**
+ * @brief Returns a Future for the product of the given Matrices, which is computed when both
+ *        of them are ready. A dimensions Exception is thrown by get() of the result.
+ * @param first The first Matrix in the multiplication operation (on the left side).
+ * @param second The second Matrix in the multiplication operation (on the right side).
+ * @return A Future for the product.
+ */
+template <class T>
+MatrixFuture<T> Matrix<T>::multiplyAsync(const MatrixFuture<T>& first,
+                                         const MatrixFuture<T>& second)
+{
+    return MatrixFuture<T>::after({first, second}, [first, second]()
+    {
+        return first.get() * second.get();
+    });
+}
+
+/**
+ * @brief Returns a Future for the sum of the given Matrices, which is computed when both of
+ *        them are ready. A dimensions Exception is thrown by get() of the result.
+ * @param first The first Matrix to add.
+ * @param second The second Matrix to add.
+ * @return A Future for the sum.
+ */
+template <class T>
+MatrixFuture<T> Matrix<T>::addAsync(const MatrixFuture<T>& first, const MatrixFuture<T>& second)
+{
+    return MatrixFuture<T>::after({first, second}, [first, second]()
+    {
+        return first.get() + second.get();
+    });
+}
+
+/**
+ * @brief Returns a Future for the Transpose of the given Matrix, which is computed when it is
+ *        ready.
+ * @param matrix The Matrix to transpose.
+ * @return A Future for the Transpose.
+ */
+template <class T>
+MatrixFuture<T> Matrix<T>::transAsync(const MatrixFuture<T>& matrix)
+{
+    return MatrixFuture<T>::after({matrix}, [matrix]()
+    {
+        return matrix.get().trans();
+    });
+}
+
+#endif
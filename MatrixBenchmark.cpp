@@ -0,0 +1,608 @@
+/**
+ * @file MatrixBenchmark.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 18 Oct 2026
+ *
+ * @brief A Benchmark Program for the Matrix Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Benchmark Program for the Matrix Class.
+ * The Program receives the name of a benchmark and the size of the Matrices, runs the
+ * benchmark on random Matrices and prints the time of each variant of the benchmark.
+ * Usage: MatrixBenchmark <benchmark> <size>
+ * Benchmarks:
+ *      lu - The blocked LU Decomposition against the non-blocked (naive) decomposition.
+ *      tiled - The disk-backed (Tiled Matrix) product (A^T * A) against the in-memory product.
+ *      chain - The optimal order of a chain of multiplications against the left to right order.
+ *      numa - The memory bandwidth of the parallel addition by the number of workers, with and
+ *             without pinning the workers to their cores.
+ *      layout - The Transpose and the products and sums of Matrices in row and column order.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <cstdlib>
+#include <cstdio>
+#include "Matrix.h"
+#include "TiledMatrix.h"
+#include "StructuredMatrix.h"
+#include "Complex.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def VALID_ARGUMENTS_COUNT 3
+ * @brief A Macro that sets the number of arguments the program expects.
+ */
+#define VALID_ARGUMENTS_COUNT 3
+
+/**
+ * @def BENCHMARK_ARGUMENT 1
+ * @brief A Macro that sets the index of the benchmark name in the program arguments.
+ */
+#define BENCHMARK_ARGUMENT 1
+
+/**
+ * @def SIZE_ARGUMENT 2
+ * @brief A Macro that sets the index of the Matrix size in the program arguments.
+ */
+#define SIZE_ARGUMENT 2
+
+/**
+ * @def USAGE_MESSAGE "Usage: MatrixBenchmark <benchmark> <size>"
+ * @brief A Macro that sets the usage message of the program.
+ */
+#define USAGE_MESSAGE "Usage: MatrixBenchmark " \
+                      "<lu|tiled|chain|numa|layout|shapes|steal|update|cache|structured|gauss|" \
+                      "kernels> " \
+                      "<size>"
+
+/**
+ * @def RANDOM_SEED 2016
+ * @brief A Macro that sets the seed of the random Matrices, so every run uses the same input.
+ */
+#define RANDOM_SEED 2016
+
+/**
+ * @def RANDOM_RANGE 1.0
+ * @brief A Macro that sets the range of the values of the random Matrices.
+ */
+#define RANDOM_RANGE 1.0
+
+/**
+ * @def TILED_INPUT_FILE "benchmark_input.tiles"
+ * @brief A Macro that sets the file of the input Matrix of the tiled benchmark.
+ */
+#define TILED_INPUT_FILE "benchmark_input.tiles"
+
+/**
+ * @def TILED_TRANSPOSE_FILE "benchmark_transpose.tiles"
+ * @brief A Macro that sets the file of the transposed Matrix of the tiled benchmark.
+ */
+#define TILED_TRANSPOSE_FILE "benchmark_transpose.tiles"
+
+/**
+ * @def TILED_RESULT_FILE "benchmark_result.tiles"
+ * @brief A Macro that sets the file of the result Matrix of the tiled benchmark.
+ */
+#define TILED_RESULT_FILE "benchmark_result.tiles"
+
+/**
+ * @def BYTES_IN_GIGABYTE 1e9
+ * @brief A Macro that sets the number of bytes in a gigabyte.
+ */
+#define BYTES_IN_GIGABYTE 1e9
+
+/**
+ * @def ADDITION_STREAMS 3
+ * @brief A Macro that sets the number of Matrices streamed by an addition (two read, one written).
+ */
+#define ADDITION_STREAMS 3
+
+/**
+ * @def CHAIN_NARROW_DIVISOR 16
+ * @brief A Macro that sets the ratio between the wide and the narrow dimensions of the chain
+ *        benchmark.
+ */
+#define CHAIN_NARROW_DIVISOR 16
+
+/**
+ * @def SHAPES_FEW_ROWS 4
+ * @brief A Macro that sets the number of rows of the short Matrices in the shapes benchmark.
+ */
+#define SHAPES_FEW_ROWS 4
+
+/**
+ * @def UPDATED_LINES 4
+ * @brief A Macro that sets the number of rows (or columns) which are changed in the update
+ *        benchmark.
+ */
+#define UPDATED_LINES 4
+
+/**
+ * @def CACHED_REPEATS 8
+ * @brief A Macro that sets the number of times the same product is computed in the cache
+ *        benchmark.
+ */
+#define CACHED_REPEATS 8
+
+/**
+ * @def STRUCTURED_BANDWIDTH 4
+ * @brief A Macro that sets the lower and upper bandwidths of the banded Matrix in the
+ *        structured benchmark.
+ */
+#define STRUCTURED_BANDWIDTH 4
+
+
+/*-----=  Benchmark Helpers  =-----*/
+
+
+/**
+ * @brief Returns the time in seconds which took to perform the given task.
+ * @param task The task to measure.
+ * @return The time in seconds of the given task.
+ */
+template <class Function>
+double measure(Function task)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    task();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+/**
+ * @brief Creates a random Matrix of doubles of the given dimensions.
+ * @param rows The number of rows in the Matrix.
+ * @param cols The number of columns in the Matrix.
+ * @return A random Matrix of the given dimensions.
+ */
+Matrix<double> randomMatrix(unsigned int rows, unsigned int cols)
+{
+    std::mt19937 generator(RANDOM_SEED);
+    std::uniform_real_distribution<double> distribution(-RANDOM_RANGE, RANDOM_RANGE);
+    std::vector<double> cells(rows * cols);
+    for (double& cell : cells)
+    {
+        cell = distribution(generator);
+    }
+    return Matrix<double>(rows, cols, cells);
+}
+
+/**
+ * @brief Creates a random square Matrix of doubles of the given size.
+ * @param size The number of rows and columns in the Matrix.
+ * @return A random Matrix of the given size.
+ */
+Matrix<double> randomMatrix(unsigned int size)
+{
+    return randomMatrix(size, size);
+}
+
+/**
+ * @brief Creates a random Matrix of Complex numbers of the given dimensions.
+ * @param rows The number of rows in the Matrix.
+ * @param cols The number of columns in the Matrix.
+ * @return A random Matrix of the given dimensions.
+ */
+Matrix<Complex> randomComplexMatrix(unsigned int rows, unsigned int cols)
+{
+    std::mt19937 generator(RANDOM_SEED);
+    std::uniform_real_distribution<double> distribution(-RANDOM_RANGE, RANDOM_RANGE);
+    std::vector<Complex> cells(rows * cols);
+    for (Complex& cell : cells)
+    {
+        cell = Complex(distribution(generator), distribution(generator));
+    }
+    return Matrix<Complex>(rows, cols, cells);
+}
+
+/**
+ * @brief Prints the time of a single variant of a benchmark.
+ * @param name The name of the variant.
+ * @param seconds The time in seconds of the variant.
+ */
+void printResult(const std::string& name, double seconds)
+{
+    std::cout << name << ": " << seconds << " sec" << std::endl;
+}
+
+
+/*-----=  Benchmarks  =-----*/
+
+
+/**
+ * @brief Benchmark the blocked LU Decomposition against the non-blocked decomposition, in
+ *        non-parallel and parallel mode, and print the residual of solving a linear system.
+ * @param size The size of the decomposed Matrix.
+ */
+void benchmarkLU(unsigned int size)
+{
+    const Matrix<double> a = randomMatrix(size);
+    const Matrix<double> b(size, 1, std::vector<double>(size, RANDOM_RANGE));
+
+    Matrix<double>::setParallel(false);
+    printResult("naive", measure([&]() { LUDecomposition<double> lu(a, size); }));
+    printResult("blocked", measure([&]() { LUDecomposition<double> lu(a); }));
+    Matrix<double>::setParallel(true);
+    printResult("blocked parallel", measure([&]() { LUDecomposition<double> lu(a); }));
+
+    Matrix<double> x = a.solve(b);
+    std::cout << "residual: " << ((a * x) - b).frobeniusNorm() << std::endl;
+}
+
+/**
+ * @brief Benchmark the disk-backed product (A^T * A), like the one of the parallel checker,
+ *        against the in-memory product. The input is streamed into it's file row by row.
+ * @param size The size of the multiplied Matrices.
+ */
+void benchmarkTiled(unsigned int size)
+{
+    const Matrix<double> a = randomMatrix(size);
+    double inMemory = measure([&]() { a.trans() * a; });
+    printResult("in-memory", inMemory);
+
+    {
+        TiledMatrix<double> input(TILED_INPUT_FILE, size, size);
+        TiledMatrix<double> transposed(TILED_TRANSPOSE_FILE, size, size);
+        TiledMatrix<double> result(TILED_RESULT_FILE, size, size);
+        for (unsigned int row = 0; row < size; row++)
+        {
+            input.writeRow(row, std::vector<double>(a.begin() + (row * size),
+                                                    a.begin() + ((row + 1) * size)));
+        }
+        printResult("tiled", measure([&]()
+        {
+            TiledMatrix<double>::trans(input, transposed);
+            TiledMatrix<double>::multiply(transposed, input, result);
+        }));
+        std::cout << "difference: " << (result.toMatrix() - (a.trans() * a)).maxAbs() << std::endl;
+    }
+
+    std::remove(TILED_INPUT_FILE);
+    std::remove(TILED_TRANSPOSE_FILE);
+    std::remove(TILED_RESULT_FILE);
+}
+
+/**
+ * @brief Benchmark a chain of multiplications with alternating wide and narrow dimensions,
+ *        in the optimal order against the left to right order, and print their estimated cost.
+ * @param size The wide dimension of the chain.
+ */
+void benchmarkChain(unsigned int size)
+{
+    unsigned int narrow = std::max(size / CHAIN_NARROW_DIVISOR, 1u);
+    const Matrix<double> a = randomMatrix(size, narrow);
+    const Matrix<double> b = randomMatrix(narrow, size);
+    const Matrix<double> c = randomMatrix(size, narrow);
+    const Matrix<double> d = randomMatrix(narrow, 1);
+
+    MatrixChainCost cost;
+    Matrix<double> optimal = multiplyChain<double>({a, b, c, d}, &cost);
+    std::cout << "naive flops: " << cost.naiveFlops << ", optimal flops: " << cost.optimalFlops
+              << std::endl;
+    printResult("left to right", measure([&]() { a * b * c * d; }));
+    printResult("optimal", measure([&]() { multiplyChain<double>({a, b, c, d}); }));
+    std::cout << "difference: " << (optimal - (a * b * c * d)).maxAbs() << std::endl;
+}
+
+/**
+ * @brief Benchmark the memory bandwidth of the parallel addition for a growing number of
+ *        workers, with and without pinning each worker to it's core. With pinning, the blocks
+ *        of rows of the result are first touched and added on the NUMA node of their worker.
+ * @param size The size of the added Matrices.
+ */
+void benchmarkNuma(unsigned int size)
+{
+    const MatrixTopology& topology = MatrixTopology::system();
+    unsigned int cores = (unsigned int) topology.workerCpus().size();
+    std::cout << "nodes: " << topology.nodesCount() << ", cores: " << cores << std::endl;
+
+    Matrix<double>::setParallel(true);
+    double bytes = ADDITION_STREAMS * (double) size * size * sizeof(double);
+    for (bool affinity : {false, true})
+    {
+        Matrix<double>::setThreadAffinity(affinity);
+        for (unsigned int workers = 1; ; workers = std::min(workers * 2, cores))
+        {
+            Matrix<double>::setWorkerCount(workers);
+
+            // The operands are created with the same workers, so their rows are placed on the
+            // nodes of the workers which read them.
+            const Matrix<double> a = randomMatrix(size) + Matrix<double>(size, size);
+            const Matrix<double> b = a + a;
+            a + b;
+            double seconds = measure([&]() { a + b; });
+            std::cout << (affinity ? "pinned" : "unpinned") << " workers " << workers << ": "
+                      << (bytes / seconds) / BYTES_IN_GIGABYTE << " GB/s" << std::endl;
+            if (workers == cores)
+            {
+                break;
+            }
+        }
+    }
+    Matrix<double>::setWorkerCount(ALL_CORES);
+    Matrix<double>::setThreadAffinity(false);
+}
+
+/**
+ * @brief Benchmark the Transpose, which only views the cells in the opposite layout, and the
+ *        products and sums of Matrices in each combination of row and column order.
+ * @param size The size of the Matrices.
+ */
+void benchmarkLayout(unsigned int size)
+{
+    const Matrix<double> a = randomMatrix(size);
+    const Matrix<double> b = randomMatrix(size).trans().trans();
+    printResult("transpose", measure([&]() { a.trans(); }));
+    const Matrix<double> transposed = a.trans();
+    printResult("transpose copy", measure([&]() { Matrix<double> copy(transposed); }));
+    printResult("row * row", measure([&]() { a * b; }));
+    printResult("row * column", measure([&]() { a * b.trans(); }));
+    printResult("column * row", measure([&]() { a.trans() * b; }));
+    printResult("column * column", measure([&]() { a.trans() * b.trans(); }));
+    printResult("row + row", measure([&]() { a + b; }));
+    printResult("column + column", measure([&]() { a.trans() + b.trans(); }));
+    printResult("row + column", measure([&]() { a + b.trans(); }));
+    std::cout << "difference: " << ((a * b.trans()) - (a * Matrix<double>(b.trans()))).maxAbs()
+              << std::endl;
+}
+
+/**
+ * @brief Benchmark the parallel products and sums of Matrices with fewer rows than cores (a
+ *        row vector, a short Matrix and an inner product), which are split into tiles of
+ *        columns or slices of their inner dimension, against non-parallel mode.
+ * @param size The long dimension of the Matrices.
+ */
+void benchmarkShapes(unsigned int size)
+{
+    const Matrix<double> row = randomMatrix(1, size);
+    const Matrix<double> square = randomMatrix(size);
+    const Matrix<double> column = randomMatrix(size, 1);
+    const Matrix<double> wide = randomMatrix(SHAPES_FEW_ROWS, size * size);
+
+    Matrix<double> parallelProduct(row * square);
+    for (bool parallel : {false, true})
+    {
+        Matrix<double>::setParallel(parallel);
+        const std::string mode(parallel ? " parallel" : "");
+        printResult("row * square" + mode, measure([&]() { parallelProduct = row * square; }));
+        printResult("row * column" + mode, measure([&]() { row * column; }));
+        printResult("wide + wide" + mode, measure([&]() { wide + wide; }));
+    }
+    Matrix<double>::setParallel(false);
+    std::cout << "difference: " << (parallelProduct - (row * square)).maxAbs() << std::endl;
+}
+
+/**
+ * @brief Benchmark the parallel decompositions, whose trailing updates shrink with each
+ *        column, with the static blocks of the parallel mode against work stealing.
+ * @param size The size of the decomposed Matrix.
+ */
+void benchmarkSteal(unsigned int size)
+{
+    const Matrix<double> a = randomMatrix(size);
+    Matrix<double> spd = a.trans() * a;
+    for (unsigned int i = 0; i < size; i++)
+    {
+        spd(i, i) += size;
+    }
+
+    Matrix<double>::setParallel(true);
+    for (bool stealing : {false, true})
+    {
+        Matrix<double>::setWorkStealing(stealing);
+        const std::string mode(stealing ? " stealing" : " static");
+        printResult("lu" + mode, measure([&]() { LUDecomposition<double> lu(a); }));
+        printResult("cholesky" + mode, measure([&]() { CholeskyDecomposition<double> c(spd); }));
+    }
+    Matrix<double>::setWorkStealing(false);
+    Matrix<double>::setParallel(false);
+}
+
+/**
+ * @brief Benchmark the update of a maintained product after a few rows or columns of it's
+ *        first Matrix changed, against multiplying the Matrices again.
+ * @param size The size of the multiplied Matrices.
+ */
+void benchmarkUpdate(unsigned int size)
+{
+    Matrix<double> a = randomMatrix(size);
+    Matrix<double> b = randomMatrix(size);
+    MatrixProduct<double> product(a, b);
+    printResult("full product", measure([&]() { a * b; }));
+
+    for (bool byRows : {true, false})
+    {
+        for (unsigned int line = 0; line < UPDATED_LINES; line++)
+        {
+            for (unsigned int i = 0; i < size; i++)
+            {
+                (byRows ? a(line, i) : a(i, line)) += RANDOM_RANGE;
+            }
+        }
+        printResult(byRows ? "rows update" : "columns update",
+                    measure([&]() { product.update(); }));
+    }
+    std::cout << "difference: " << (product.result() - (a * b)).maxAbs() << std::endl;
+}
+
+/**
+ * @brief Benchmark a product which is repeated on the same Matrices, with and without the
+ *        result cache, and print the statistics of the cache.
+ * @param size The size of the multiplied Matrices.
+ */
+void benchmarkCache(unsigned int size)
+{
+    const Matrix<double> a = randomMatrix(size);
+    const Matrix<double> b = randomMatrix(size);
+    for (bool cached : {false, true})
+    {
+        Matrix<double>::setResultCache(cached);
+        printResult(cached ? "cached products" : "products", measure([&]()
+        {
+            for (unsigned int repeat = 0; repeat < CACHED_REPEATS; repeat++)
+            {
+                a * b;
+            }
+        }));
+    }
+    Matrix<double>::setResultCache(false);
+
+    const MatrixCacheStats stats = MatrixCache<double>::shared().stats();
+    std::cout << "hits: " << stats.hits << ", misses: " << stats.misses << ", evictions: "
+              << stats.evictions << ", bytes: " << stats.bytes << std::endl;
+}
+
+/**
+ * @brief Benchmark the products of Structured Matrices and a dense Matrix against the dense
+ *        products of the same Matrices.
+ * @param size The size of the multiplied Matrices.
+ */
+void benchmarkStructured(unsigned int size)
+{
+    const Matrix<double> a = randomMatrix(size);
+    const Matrix<double> b = randomMatrix(size);
+    const struct
+    {
+        const char *name;
+        MatrixStructure structure;
+    } variants[] = {{"diagonal", DIAGONAL}, {"banded", BANDED}, {"triangular", LOWER_TRIANGULAR},
+                    {"symmetric", SYMMETRIC}};
+    printResult("dense", measure([&]() { a * b; }));
+    for (const auto& variant : variants)
+    {
+        const StructuredMatrix<double> structured(a, variant.structure, STRUCTURED_BANDWIDTH,
+                                                  STRUCTURED_BANDWIDTH);
+        printResult(variant.name, measure([&]() { structured * b; }));
+    }
+}
+
+/**
+ * @brief Benchmark the product of a Complex Matrix and it's conjugate transpose (like the
+ *        product in BonusParallelChecker) by four real products per cell against three real
+ *        products (the Gauss Multiplication), and print the largest difference between them.
+ * @param size The size of the multiplied Matrices.
+ */
+void benchmarkGauss(unsigned int size)
+{
+    const Matrix<Complex> a = randomComplexMatrix(size, size);
+    const Matrix<Complex> b = a.trans();
+    Matrix<Complex> exact;
+    Matrix<Complex> gauss;
+    printResult("complex product", measure([&]() { exact = b * a; }));
+    Matrix<Complex>::setGaussMultiplication(true);
+    printResult("gauss product", measure([&]() { gauss = b * a; }));
+    Matrix<Complex>::setGaussMultiplication(false);
+    std::cout << "difference: " << (exact - gauss).maxAbs() << std::endl;
+}
+
+/**
+ * @brief Print the variant of the kernels which is used by this process, and benchmark the
+ *        operators which use them. Run it with MATRIX_KERNELS=baseline (or avx2) to compare
+ *        the variants.
+ * @param size The size of the Matrices.
+ */
+void benchmarkKernels(unsigned int size)
+{
+    std::cout << "kernels: " << MatrixKernels::variantName(MatrixKernels::variant())
+              << std::endl;
+    const Matrix<double> a = randomMatrix(size);
+    const Matrix<double> b = randomMatrix(size);
+    const Matrix<Complex> c = randomComplexMatrix(size, size);
+    printResult("addition", measure([&]() { a + b; }));
+    printResult("subtraction", measure([&]() { c - c; }));
+    printResult("product", measure([&]() { a * b; }));
+}
+
+
+/*-----=  Main  =-----*/
+
+
+/**
+ * @brief The main function of the program, which runs the requested benchmark.
+ * @param argc The number of arguments.
+ * @param argv The arguments, which are the benchmark name and the Matrix size.
+ * @return 0 on success, or EXIT_FAILURE on invalid arguments.
+ */
+int main(int argc, char *argv[])
+{
+    if (argc != VALID_ARGUMENTS_COUNT)
+    {
+        std::cerr << USAGE_MESSAGE << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::string benchmark(argv[BENCHMARK_ARGUMENT]);
+    unsigned int size = (unsigned int) std::atoi(argv[SIZE_ARGUMENT]);
+
+    if (benchmark == "lu")
+    {
+        benchmarkLU(size);
+    }
+    else if (benchmark == "tiled")
+    {
+        benchmarkTiled(size);
+    }
+    else if (benchmark == "chain")
+    {
+        benchmarkChain(size);
+    }
+    else if (benchmark == "numa")
+    {
+        benchmarkNuma(size);
+    }
+    else if (benchmark == "layout")
+    {
+        benchmarkLayout(size);
+    }
+    else if (benchmark == "shapes")
+    {
+        benchmarkShapes(size);
+    }
+    else if (benchmark == "steal")
+    {
+        benchmarkSteal(size);
+    }
+    else if (benchmark == "update")
+    {
+        benchmarkUpdate(size);
+    }
+    else if (benchmark == "cache")
+    {
+        benchmarkCache(size);
+    }
+    else if (benchmark == "structured")
+    {
+        benchmarkStructured(size);
+    }
+    else if (benchmark == "gauss")
+    {
+        benchmarkGauss(size);
+    }
+    else if (benchmark == "kernels")
+    {
+        benchmarkKernels(size);
+    }
+    else
+    {
+        std::cerr << USAGE_MESSAGE << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return 0;
+}
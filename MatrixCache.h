@@ -0,0 +1,264 @@
+/**
+ * @file MatrixCache.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 18 Oct 2026
+ *
+ * @brief A Header File for the Matrix Cache Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the Matrix Cache Class.
+ * The Matrix Cache remembers the results of the Matrix operations, keyed by the operation and
+ * the checksums of it's operands, so an operation which is repeated on Matrices with the same
+ * content returns the remembered result instead of computing it again. The checksums are
+ * cached by the Matrices themselves, so a lookup of unchanged operands takes constant time.
+ * The results are kept up to a bounded number of bytes, and the least recently used results
+ * are evicted first. A returned result shares the cells of the remembered result until one of
+ * them is changed, like a copy in copy on write mode.
+ * Like the Matrix Class, this .h file includes it's .hpp file because this is a Template Class.
+ */
+
+
+#ifndef _MATRIXCACHE_H
+#define _MATRIXCACHE_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <list>
+#include <mutex>
+#include <cstdint>
+#include <unordered_map>
+#include <type_traits>
+#include "Matrix.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def DEFAULT_CACHE_CAPACITY 268435456
+ * @brief A Macro that sets the default number of bytes of the results which a cache keeps.
+ */
+#define DEFAULT_CACHE_CAPACITY 268435456
+
+
+/*-----=  Class Definition  =-----*/
+
+
+/**
+ * @brief A Struct representing the statistics of a Matrix Cache.
+ */
+struct MatrixCacheStats
+{
+    /**
+     * @brief The number of lookups which found a result.
+     */
+    unsigned long hits;
+
+    /**
+     * @brief The number of lookups which computed the result.
+     */
+    unsigned long misses;
+
+    /**
+     * @brief The number of results which were evicted to keep the capacity.
+     */
+    unsigned long evictions;
+
+    /**
+     * @brief The number of results which are kept.
+     */
+    std::size_t entries;
+
+    /**
+     * @brief The number of bytes of the cells of the kept results.
+     */
+    std::size_t bytes;
+};
+
+
+/**
+ * @brief A Class representing a cache of the results of Matrix operations, with a bounded
+ *        capacity and a least recently used eviction. The cache may be used from several
+ *        threads at once. The operations are computed outside of the lock of the cache, so an
+ *        operation which is missed by several threads at once is computed by each of them.
+ *        The operands are identified by their 64 bits checksums, so two different operands
+ *        share a result only if their checksums collide (about 2^-64 for a pair of operands).
+ */
+template <class T>
+class MatrixCache
+{
+public:
+
+    /**
+     * @brief Returns the cache which is used by the Matrix operators when the Result Cache
+     *        Flag is on.
+     * @return The shared cache.
+     */
+    static MatrixCache<T>& shared()
+    {
+        static MatrixCache<T> cache;
+        return cache;
+    };
+
+    /**
+     * @brief A Constructor for an empty cache with the given capacity.
+     * @param capacity The number of bytes of the results which the cache keeps.
+     */
+    explicit MatrixCache(std::size_t capacity = DEFAULT_CACHE_CAPACITY);
+
+    /**
+     * @brief Returns the result of the given operation on the given Matrices. If the cache
+     *        keeps the result of the same operation on Matrices with the same checksums, it is
+     *        returned, otherwise the result is computed by the given function and kept.
+     *        An Exception which is thrown by the function is passed to the caller, and nothing
+     *        is kept. The result of an element type without a hash (see ScalarTraits) is
+     *        always computed.
+     * @param operation The operation.
+     * @param first The first operand.
+     * @param second The second operand.
+     * @param compute The function which computes the result of the operation.
+     * @return The result of the operation.
+     */
+    template <class Function>
+    Matrix<T> lookup(MatrixCacheOperation operation, const Matrix<T>& first,
+                     const Matrix<T>& second, Function compute);
+
+    /**
+     * @brief Sets the capacity of the cache, and evicts the least recently used results until
+     *        the kept results fit it.
+     * @param capacity The number of bytes of the results which the cache keeps.
+     */
+    void setCapacity(std::size_t capacity);
+
+    /**
+     * @brief Returns the capacity of the cache.
+     * @return The number of bytes of the results which the cache keeps.
+     */
+    std::size_t capacity() const;
+
+    /**
+     * @brief Returns the statistics of the cache.
+     * @return The statistics of the cache.
+     */
+    MatrixCacheStats stats() const;
+
+    /**
+     * @brief Remove all the kept results. The statistics are kept.
+     */
+    void clear();
+
+private:
+
+    /**
+     * @brief A Struct representing the key of a result, i.e. the operation and the checksums
+     *        of it's operands.
+     */
+    struct Key
+    {
+        MatrixCacheOperation operation;
+        std::uint64_t first;
+        std::uint64_t second;
+
+        bool operator==(const Key& other) const
+        {
+            return operation == other.operation && first == other.first &&
+                   second == other.second;
+        };
+    };
+
+    /**
+     * @brief A Struct representing the hash function of a key.
+     */
+    struct KeyHash
+    {
+        std::size_t operator()(const Key& key) const;
+    };
+
+    /**
+     * @brief A Struct representing a kept result.
+     */
+    struct Entry
+    {
+        Key key;
+        Matrix<T> result;
+        std::size_t bytes;
+    };
+
+    /**
+     * @brief The kept results, from the most recently used to the least recently used.
+     */
+    std::list<Entry> _entries;
+
+    /**
+     * @brief The position of each kept result in the list of results.
+     */
+    std::unordered_map<Key, typename std::list<Entry>::iterator, KeyHash> _index;
+
+    /**
+     * @brief A mutex which guards the results and the statistics.
+     */
+    mutable std::mutex _mutex;
+
+    /**
+     * @brief The number of bytes of the results which the cache keeps.
+     */
+    std::size_t _capacity;
+
+    /**
+     * @brief The statistics of the cache.
+     */
+    MatrixCacheStats _stats;
+
+    /**
+     * @brief Returns the result of the given operation on the given Matrices of a hashable
+     *        element type, from the cache or by computing and keeping it.
+     * @param operation The operation.
+     * @param first The first operand.
+     * @param second The second operand.
+     * @param compute The function which computes the result of the operation.
+     * @return The result of the operation.
+     */
+    template <class Function>
+    Matrix<T> _lookup(MatrixCacheOperation operation, const Matrix<T>& first,
+                      const Matrix<T>& second, Function compute, std::true_type);
+
+    /**
+     * @brief Returns the result of the given operation on the given Matrices of an element
+     *        type without a hash, which has no checksums to key it, so it is always computed.
+     * @param compute The function which computes the result of the operation.
+     * @return The result of the operation.
+     */
+    template <class Function>
+    Matrix<T> _lookup(MatrixCacheOperation, const Matrix<T>&, const Matrix<T>&, Function compute,
+                      std::false_type)
+    {
+        return compute();
+    };
+
+    /**
+     * @brief Evict the least recently used results until the kept results fit the capacity.
+     *        The mutex must be locked.
+     */
+    void _evict();
+
+    /**
+     * @brief Returns the number of bytes of the cells of the given Matrix.
+     * @param matrix The Matrix.
+     * @return The number of bytes of the cells of the Matrix.
+     */
+    static std::size_t _bytes(const Matrix<T>& matrix)
+    {
+        return (std::size_t) matrix.rows() * matrix.cols() * sizeof(T);
+    };
+};
+
+
+#include "MatrixCache.hpp"
+
+#endif
@@ -0,0 +1,199 @@
+/**
+ * @file MatrixCache.hpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 18 Oct 2026
+ *
+ * @brief An implementation of the Matrix Cache Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * An implementation of the Matrix Cache Class.
+ */
+
+
+#ifndef _MATRIXCACHE_HPP
+#define _MATRIXCACHE_HPP
+
+
+/*-----=  Includes  =-----*/
+
+
+#include "MatrixCache.h"
+#include "ScalarTraits.h"
+
+
+/*-----=  Constructors  =-----*/
+
+
+/**
+ * @brief A Constructor for an empty cache with the given capacity.
+ * @param capacity The number of bytes of the results which the cache keeps.
+ */
+template <class T>
+MatrixCache<T>::MatrixCache(std::size_t capacity) : _capacity(capacity), _stats()
+{
+
+}
+
+
+/*-----=  Cache Functions  =-----*/
+
+
+/**
+ * @brief Returns the hash of the given key.
+ * @param key The key.
+ * @return The hash of the key.
+ */
+template <class T>
+std::size_t MatrixCache<T>::KeyHash::operator()(const Key& key) const
+{
+    std::uint64_t hash = (key.first * HASH_MULTIPLIER) ^ key.second;
+    return (std::size_t) ((hash * HASH_MULTIPLIER) ^ (std::uint64_t) key.operation);
+}
+
+/**
+ * @brief Returns the result of the given operation on the given Matrices. If the cache keeps
+ *        the result of the same operation on Matrices with the same checksums, it is returned,
+ *        otherwise the result is computed by the given function and kept.
+ *        An Exception which is thrown by the function is passed to the caller, and nothing is
+ *        kept. The result of an element type without a hash (see ScalarTraits) is always
+ *        computed.
+ * @param operation The operation.
+ * @param first The first operand.
+ * @param second The second operand.
+ * @param compute The function which computes the result of the operation.
+ * @return The result of the operation.
+ */
+template <class T>
+template <class Function>
+Matrix<T> MatrixCache<T>::lookup(MatrixCacheOperation operation, const Matrix<T>& first,
+                                 const Matrix<T>& second, Function compute)
+{
+    return _lookup(operation, first, second, compute,
+                   std::integral_constant<bool, ScalarTraits<T>::hashable>());
+}
+
+/**
+ * @brief Returns the result of the given operation on the given Matrices of a hashable element
+ *        type, from the cache or by computing and keeping it.
+ * @param operation The operation.
+ * @param first The first operand.
+ * @param second The second operand.
+ * @param compute The function which computes the result of the operation.
+ * @return The result of the operation.
+ */
+template <class T>
+template <class Function>
+Matrix<T> MatrixCache<T>::_lookup(MatrixCacheOperation operation, const Matrix<T>& first,
+                                  const Matrix<T>& second, Function compute, std::true_type)
+{
+    // A single result is returned from every path, so it is never copied on the way out.
+    const Key key = {operation, first.checksum(), second.checksum()};
+    Matrix<T> result(EMPTY_MATRIX_SIZE, EMPTY_MATRIX_SIZE);
+    bool hit = false;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        typename std::unordered_map<Key, typename std::list<Entry>::iterator,
+                                    KeyHash>::iterator found = _index.find(key);
+        if (found != _index.end())
+        {
+            _entries.splice(_entries.begin(), _entries, found -> second);
+            _stats.hits++;
+            Matrix<T>::_share(found -> second -> result, result);
+            hit = true;
+        }
+        else
+        {
+            _stats.misses++;
+        }
+    }
+
+    if (!hit)
+    {
+        result = compute();
+        const std::size_t bytes = _bytes(result);
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (bytes <= _capacity && _index.find(key) == _index.end())
+        {
+            _entries.push_front(Entry{key, Matrix<T>(EMPTY_MATRIX_SIZE, EMPTY_MATRIX_SIZE),
+                                      bytes});
+            Matrix<T>::_share(result, _entries.front().result);
+            _index[key] = _entries.begin();
+            _stats.entries++;
+            _stats.bytes += bytes;
+            _evict();
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Sets the capacity of the cache, and evicts the least recently used results until the
+ *        kept results fit it.
+ * @param capacity The number of bytes of the results which the cache keeps.
+ */
+template <class T>
+void MatrixCache<T>::setCapacity(std::size_t capacity)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _capacity = capacity;
+    _evict();
+}
+
+/**
+ * @brief Returns the capacity of the cache.
+ * @return The number of bytes of the results which the cache keeps.
+ */
+template <class T>
+std::size_t MatrixCache<T>::capacity() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _capacity;
+}
+
+/**
+ * @brief Returns the statistics of the cache.
+ * @return The statistics of the cache.
+ */
+template <class T>
+MatrixCacheStats MatrixCache<T>::stats() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _stats;
+}
+
+/**
+ * @brief Remove all the kept results. The statistics are kept.
+ */
+template <class T>
+void MatrixCache<T>::clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _entries.clear();
+    _index.clear();
+    _stats.entries = 0;
+    _stats.bytes = 0;
+}
+
+/**
+ * @brief Evict the least recently used results until the kept results fit the capacity.
+ *        The mutex must be locked.
+ */
+template <class T>
+void MatrixCache<T>::_evict()
+{
+    while (_stats.bytes > _capacity)
+    {
+        const Entry& last = _entries.back();
+        _stats.bytes -= last.bytes;
+        _stats.entries--;
+        _stats.evictions++;
+        _index.erase(last.key);
+        _entries.pop_back();
+    }
+}
+
+#endif
@@ -0,0 +1,341 @@
+/**
+ * @file MatrixClient.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 18 Oct 2026
+ *
+ * @brief A Header File for the Matrix Client Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the Matrix Client Class.
+ * The Matrix Client is a connection to the Matrix Daemon (see MatrixDaemon.cpp), which keeps
+ * named Matrices resident between the runs of the programs. The Matrices are loaded into the
+ * daemon once, the operations are performed on them by their names (and their results are
+ * kept by the daemon under new names), and only the Matrices which are needed are stored back.
+ * An error of a Matrix operation in the daemon is thrown by the client as the same Exception
+ * which the operation throws locally.
+ */
+
+
+#ifndef _MATRIXCLIENT_H
+#define _MATRIXCLIENT_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <cstring>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "MatrixProtocol.h"
+
+
+/*-----=  Class Definition  =-----*/
+
+
+/**
+ * @brief A Class representing a connection to the Matrix Daemon. The requests of a single
+ *        client are performed one at a time, so a client must not be used from several
+ *        threads at once (each thread may have it's own client).
+ */
+class MatrixClient
+{
+public:
+
+    /**
+     * @brief A Constructor which connects to the daemon on the given socket.
+     *        If the daemon cannot be reached, an Exception will be thrown.
+     * @param path The path of the socket of the daemon.
+     * @param maxCells The largest number of cells in a loaded Matrix, as the daemon was
+     *        started with.
+     */
+    explicit MatrixClient(const std::string& path = DEFAULT_DAEMON_SOCKET,
+                          std::uint64_t maxCells = MAX_DAEMON_CELLS);
+
+    /**
+     * @brief The Destructor closes the connection. The Matrices stay in the daemon.
+     */
+    ~MatrixClient();
+
+    /**
+     * @brief A client owns it's connection, so it cannot be copied.
+     */
+    MatrixClient(const MatrixClient&) = delete;
+
+    /**
+     * @brief A client owns it's connection, so it cannot be assigned.
+     */
+    MatrixClient& operator=(const MatrixClient&) = delete;
+
+    /**
+     * @brief Load the given Matrix into the daemon under the given name, in place of the
+     *        Matrix which had this name.
+     * @param name The name of the Matrix.
+     * @param matrix The Matrix.
+     */
+    template <class T>
+    void load(const std::string& name, const Matrix<T>& matrix);
+
+    /**
+     * @brief Returns the Matrix which the daemon holds under the given name.
+     * @param name The name of the Matrix.
+     * @return The Matrix.
+     */
+    template <class T>
+    Matrix<T> store(const std::string& name);
+
+    /**
+     * @brief Remove the Matrix with the given name from the daemon.
+     * @param name The name of the Matrix.
+     */
+    template <class T>
+    void drop(const std::string& name);
+
+    /**
+     * @brief Keep the transpose of a Matrix of the daemon under the given name.
+     * @param result The name of the result.
+     * @param source The name of the transposed Matrix.
+     */
+    template <class T>
+    void transpose(const std::string& result, const std::string& source);
+
+    /**
+     * @brief Keep the sum of two Matrices of the daemon under the given name.
+     * @param result The name of the result.
+     * @param first The name of the first Matrix.
+     * @param second The name of the second Matrix.
+     */
+    template <class T>
+    void add(const std::string& result, const std::string& first, const std::string& second);
+
+    /**
+     * @brief Keep the difference of two Matrices of the daemon under the given name.
+     * @param result The name of the result.
+     * @param first The name of the Matrix to subtract from.
+     * @param second The name of the Matrix to subtract.
+     */
+    template <class T>
+    void subtract(const std::string& result, const std::string& first,
+                  const std::string& second);
+
+    /**
+     * @brief Keep the product of two Matrices of the daemon under the given name.
+     * @param result The name of the result.
+     * @param first The name of the first Matrix (on the left side).
+     * @param second The name of the second Matrix (on the right side).
+     */
+    template <class T>
+    void multiply(const std::string& result, const std::string& first,
+                  const std::string& second);
+
+private:
+
+    /**
+     * @brief The socket of the connection.
+     */
+    int _socket;
+
+    /**
+     * @brief The largest number of cells in a loaded Matrix.
+     */
+    std::uint64_t _maxCells;
+
+    /**
+     * @brief Send a request to the daemon and receive the header of it's response.
+     *        If the daemon has failed the request, the matching Exception will be thrown.
+     * @param operation The operation.
+     * @param names The names of the request.
+     * @param matrix The Matrix to load, or nullptr for the other operations.
+     * @return The header of the response.
+     */
+    template <class T>
+    MatrixResponseHeader _request(MatrixDaemonOperation operation,
+                                  const std::vector<std::string>& names,
+                                  const Matrix<T> *matrix = nullptr);
+};
+
+
+/*-----=  Implementation  =-----*/
+
+
+/**
+ * @brief A Constructor which connects to the daemon on the given socket.
+ *        If the daemon cannot be reached, an Exception will be thrown.
+ * @param path The path of the socket of the daemon.
+ * @param maxCells The largest number of cells in a loaded Matrix, as the daemon was started
+ *        with.
+ */
+inline MatrixClient::MatrixClient(const std::string& path, std::uint64_t maxCells)
+        : _socket(socket(AF_UNIX, SOCK_STREAM, 0)), _maxCells(maxCells)
+{
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (_socket < 0 || path.size() >= sizeof(address.sun_path))
+    {
+        if (_socket >= 0)
+        {
+            close(_socket);
+        }
+        throw MatrixDaemonException();
+    }
+    std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+    if (connect(_socket, (const sockaddr *) &address, sizeof(address)) < 0)
+    {
+        close(_socket);
+        throw MatrixDaemonException();
+    }
+}
+
+/**
+ * @brief The Destructor closes the connection. The Matrices stay in the daemon.
+ */
+inline MatrixClient::~MatrixClient()
+{
+    close(_socket);
+}
+
+/**
+ * @brief Load the given Matrix into the daemon under the given name, in place of the Matrix
+ *        which had this name.
+ * @param name The name of the Matrix.
+ * @param matrix The Matrix.
+ */
+template <class T>
+void MatrixClient::load(const std::string& name, const Matrix<T>& matrix)
+{
+    _request<T>(DAEMON_LOAD, {name}, &matrix);
+}
+
+/**
+ * @brief Returns the Matrix which the daemon holds under the given name.
+ * @param name The name of the Matrix.
+ * @return The Matrix.
+ */
+template <class T>
+Matrix<T> MatrixClient::store(const std::string& name)
+{
+    const MatrixResponseHeader response = _request<T>(DAEMON_STORE, {name});
+    return MatrixProtocol::receiveCells<T>(_socket, response.rows, response.cols);
+}
+
+/**
+ * @brief Remove the Matrix with the given name from the daemon.
+ * @param name The name of the Matrix.
+ */
+template <class T>
+void MatrixClient::drop(const std::string& name)
+{
+    _request<T>(DAEMON_DROP, {name});
+}
+
+/**
+ * @brief Keep the transpose of a Matrix of the daemon under the given name.
+ * @param result The name of the result.
+ * @param source The name of the transposed Matrix.
+ */
+template <class T>
+void MatrixClient::transpose(const std::string& result, const std::string& source)
+{
+    _request<T>(DAEMON_TRANSPOSE, {result, source});
+}
+
+/**
+ * @brief Keep the sum of two Matrices of the daemon under the given name.
+ * @param result The name of the result.
+ * @param first The name of the first Matrix.
+ * @param second The name of the second Matrix.
+ */
+template <class T>
+void MatrixClient::add(const std::string& result, const std::string& first,
+                       const std::string& second)
+{
+    _request<T>(DAEMON_ADD, {result, first, second});
+}
+
+/**
+ * @brief Keep the difference of two Matrices of the daemon under the given name.
+ * @param result The name of the result.
+ * @param first The name of the Matrix to subtract from.
+ * @param second The name of the Matrix to subtract.
+ */
+template <class T>
+void MatrixClient::subtract(const std::string& result, const std::string& first,
+                            const std::string& second)
+{
+    _request<T>(DAEMON_SUBTRACT, {result, first, second});
+}
+
+/**
+ * @brief Keep the product of two Matrices of the daemon under the given name.
+ * @param result The name of the result.
+ * @param first The name of the first Matrix (on the left side).
+ * @param second The name of the second Matrix (on the right side).
+ */
+template <class T>
+void MatrixClient::multiply(const std::string& result, const std::string& first,
+                            const std::string& second)
+{
+    _request<T>(DAEMON_MULTIPLY, {result, first, second});
+}
+
+/**
+ * @brief Send a request to the daemon and receive the header of it's response.
+ *        If the daemon has failed the request, the matching Exception will be thrown.
+ * @param operation The operation.
+ * @param names The names of the request.
+ * @param matrix The Matrix to load, or nullptr for the other operations.
+ * @return The header of the response.
+ */
+template <class T>
+MatrixResponseHeader MatrixClient::_request(MatrixDaemonOperation operation,
+                                            const std::vector<std::string>& names,
+                                            const Matrix<T> *matrix)
+{
+    MatrixRequestHeader request = {(std::uint8_t) operation,
+                                   (std::uint8_t) MatrixElement<T>::type,
+                                   (std::uint8_t) names.size(), 0, 0, 0};
+    if (matrix != nullptr)
+    {
+        request.rows = matrix -> rows();
+        request.cols = matrix -> cols();
+        if (!MatrixProtocol::validDimensions(request.rows, request.cols, _maxCells))
+        {
+            throw MatrixDimensionsException();
+        }
+    }
+    MatrixProtocol::send(_socket, &request, sizeof(request));
+    for (const std::string& name : names)
+    {
+        MatrixProtocol::sendName(_socket, name);
+    }
+    if (matrix != nullptr)
+    {
+        MatrixProtocol::sendCells(_socket, *matrix);
+    }
+
+    MatrixResponseHeader response;
+    if (!MatrixProtocol::receive(_socket, &response, sizeof(response)))
+    {
+        throw MatrixDaemonException();
+    }
+    switch (response.status)
+    {
+        case DAEMON_OK:
+            return response;
+        case DAEMON_DIMENSIONS_ERROR:
+            throw MatrixDimensionsException();
+        case DAEMON_OVERFLOW_ERROR:
+            throw MatrixOverflowException();
+        case DAEMON_NAME_ERROR:
+            throw MatrixNameException();
+        default:
+            throw MatrixDaemonException();
+    }
+}
+
+#endif
@@ -0,0 +1,459 @@
+/**
+ * @file MatrixDaemon.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 18 Oct 2026
+ *
+ * @brief A Daemon Program which keeps named Matrices resident and performs operations on them.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Daemon Program which keeps named Matrices resident and performs operations on them.
+ * The Program listens on a Unix domain socket, and serves each connected client (see
+ * MatrixClient.h) by the Matrix Protocol (see MatrixProtocol.h), so a program which performs
+ * many operations pays the parsing of it's Matrices and the start of the workers only once.
+ * Each connection is served by it's own thread, and the operations run in the parallel mode of
+ * the Matrix on the workers of the work stealing scheduler, which are started with the daemon
+ * and stay warm between the requests. The scheduler performs a single parallel range at a
+ * time with all the workers, so the parallel parts of the operations of different clients run
+ * one after the other (the reading and writing of the Matrices of the clients still overlap).
+ * The results are kept under their names. An operation works on the Matrices which had it's
+ * names when it started, so a Matrix which is replaced meanwhile doesn't change it's result.
+ * Usage: MatrixDaemon [socket path] [max cells]
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <csignal>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include "Matrix.h"
+#include "Complex.h"
+#include "MatrixProtocol.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def MAX_ARGUMENTS_COUNT 3
+ * @brief A Macro that sets the largest number of arguments the program expects.
+ */
+#define MAX_ARGUMENTS_COUNT 3
+
+/**
+ * @def SOCKET_ARGUMENT 1
+ * @brief A Macro that sets the index of the socket path in the program arguments.
+ */
+#define SOCKET_ARGUMENT 1
+
+/**
+ * @def CELLS_ARGUMENT 2
+ * @brief A Macro that sets the index of the largest number of cells in a loaded Matrix in the
+ *        program arguments.
+ */
+#define CELLS_ARGUMENT 2
+
+/**
+ * @def USAGE_MESSAGE "Usage: MatrixDaemon [socket path] [max cells]"
+ * @brief A Macro that sets the usage message of the program.
+ */
+#define USAGE_MESSAGE "Usage: MatrixDaemon [socket path] [max cells]"
+
+/**
+ * @def SOCKET_UMASK 0077
+ * @brief A Macro that sets the file mode mask which the socket is created with, so only it's
+ *        owner may connect.
+ */
+#define SOCKET_UMASK 0077
+
+/**
+ * @def ACCEPT_RETRY_MILLISECONDS 100
+ * @brief A Macro that sets the time to wait before accepting again after a failure (e.g. when
+ *        the process is out of file descriptors).
+ */
+#define ACCEPT_RETRY_MILLISECONDS 100
+
+
+/*-----=  Resident Matrices  =-----*/
+
+
+/**
+ * @brief A Class representing the resident Matrices of a single element type, by their names.
+ *        The Matrices are immutable once they are kept, so an operation may use them without
+ *        holding the lock.
+ */
+template <class T>
+class Residents
+{
+public:
+
+    /**
+     * @brief Returns the Matrix with the given name.
+     *        If there is no such Matrix, an Exception will be thrown.
+     * @param name The name of the Matrix.
+     * @return The Matrix.
+     */
+    std::shared_ptr<const Matrix<T>> find(const std::string& name) const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        typename Map::const_iterator found = _matrices.find(name);
+        if (found == _matrices.end())
+        {
+            throw MatrixNameException();
+        }
+        return found -> second;
+    };
+
+    /**
+     * @brief Keep the given Matrix under the given name, in place of the Matrix which had it.
+     * @param name The name of the Matrix.
+     * @param matrix The Matrix.
+     */
+    void keep(const std::string& name, const std::shared_ptr<const Matrix<T>>& matrix)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _matrices[name] = matrix;
+    };
+
+    /**
+     * @brief Remove the Matrix with the given name.
+     *        If there is no such Matrix, an Exception will be thrown.
+     * @param name The name of the Matrix.
+     */
+    void drop(const std::string& name)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_matrices.erase(name) == 0)
+        {
+            throw MatrixNameException();
+        }
+    };
+
+private:
+
+    typedef std::unordered_map<std::string, std::shared_ptr<const Matrix<T>>> Map;
+
+    /**
+     * @brief The Matrices by their names.
+     */
+    Map _matrices;
+
+    /**
+     * @brief A mutex which guards the names.
+     */
+    mutable std::mutex _mutex;
+};
+
+
+/**
+ * @brief The resident int Matrices.
+ */
+Residents<int> intResidents;
+
+/**
+ * @brief The resident double Matrices.
+ */
+Residents<double> doubleResidents;
+
+/**
+ * @brief The resident Complex Matrices.
+ */
+Residents<Complex> complexResidents;
+
+/**
+ * @brief The largest number of cells in a loaded Matrix. The cells of a load are received
+ *        straight into a Matrix of this size at most.
+ */
+std::uint64_t maxCells = MAX_DAEMON_CELLS;
+
+
+/*-----=  Requests  =-----*/
+
+
+/**
+ * @brief Perform the given request on the given resident Matrices, and send it's response.
+ *        An error of the operation is thrown to the caller.
+ * @param connection The socket of the client.
+ * @param request The header of the request.
+ * @param names The names of the request.
+ * @param residents The resident Matrices of the element type of the request.
+ */
+template <class T>
+void perform(int connection, const MatrixRequestHeader& request,
+             const std::vector<std::string>& names, Residents<T>& residents)
+{
+    std::shared_ptr<const Matrix<T>> result;
+    switch (request.operation)
+    {
+        case DAEMON_LOAD:
+            result = std::make_shared<const Matrix<T>>(
+                    MatrixProtocol::receiveCells<T>(connection, request.rows, request.cols));
+            break;
+        case DAEMON_STORE:
+            result = residents.find(names[0]);
+            break;
+        case DAEMON_DROP:
+            residents.drop(names[0]);
+            break;
+        case DAEMON_TRANSPOSE:
+            result = std::make_shared<const Matrix<T>>(residents.find(names[1]) -> trans());
+            break;
+        case DAEMON_ADD:
+            result = std::make_shared<const Matrix<T>>(*residents.find(names[1]) +
+                                                       *residents.find(names[2]));
+            break;
+        case DAEMON_SUBTRACT:
+            result = std::make_shared<const Matrix<T>>(*residents.find(names[1]) -
+                                                       *residents.find(names[2]));
+            break;
+        default:
+            result = std::make_shared<const Matrix<T>>(*residents.find(names[1]) *
+                                                       *residents.find(names[2]));
+            break;
+    }
+    if (request.operation != DAEMON_STORE && result)
+    {
+        residents.keep(names[0], result);
+    }
+
+    MatrixResponseHeader response = {DAEMON_OK, {0, 0, 0}, 0, 0};
+    if (result)
+    {
+        response.rows = result -> rows();
+        response.cols = result -> cols();
+    }
+    MatrixProtocol::send(connection, &response, sizeof(response));
+    if (request.operation == DAEMON_STORE)
+    {
+        MatrixProtocol::sendCells(connection, *result);
+    }
+}
+
+/**
+ * @brief Send a response with the given status (and no result) to the client.
+ * @param connection The socket of the client.
+ * @param status The status of the response.
+ */
+void reject(int connection, MatrixDaemonStatus status)
+{
+    const MatrixResponseHeader response = {(std::uint8_t) status, {0, 0, 0}, 0, 0};
+    MatrixProtocol::send(connection, &response, sizeof(response));
+}
+
+/**
+ * @brief Serve the requests of a client until it closes the connection, or until it sends a
+ *        request which cannot be read (after which the rest of the connection can't be read
+ *        either). An error of an operation is sent to the client, and the connection goes on.
+ * @param connection The socket of the client.
+ */
+void serve(int connection)
+{
+    try
+    {
+        MatrixRequestHeader request;
+        while (MatrixProtocol::receive(connection, &request, sizeof(request)))
+        {
+            const unsigned int count = MatrixProtocol::names(request.operation);
+            if (count == 0 || request.names != count || request.type < INT_ELEMENTS ||
+                request.type > COMPLEX_ELEMENTS || (request.operation == DAEMON_LOAD &&
+                !MatrixProtocol::validDimensions(request.rows, request.cols, maxCells)))
+            {
+                reject(connection, DAEMON_REQUEST_ERROR);
+                break;
+            }
+            std::vector<std::string> names;
+            for (unsigned int name = 0; name < count; name++)
+            {
+                names.push_back(MatrixProtocol::receiveName(connection));
+            }
+
+            try
+            {
+                switch (request.type)
+                {
+                    case INT_ELEMENTS:
+                        perform(connection, request, names, intResidents);
+                        break;
+                    case DOUBLE_ELEMENTS:
+                        perform(connection, request, names, doubleResidents);
+                        break;
+                    default:
+                        perform(connection, request, names, complexResidents);
+                        break;
+                }
+            }
+            catch (MatrixDimensionsException& exception)
+            {
+                reject(connection, DAEMON_DIMENSIONS_ERROR);
+            }
+            catch (MatrixOverflowException& exception)
+            {
+                reject(connection, DAEMON_OVERFLOW_ERROR);
+            }
+            catch (MatrixNameException& exception)
+            {
+                reject(connection, DAEMON_NAME_ERROR);
+            }
+        }
+    }
+    catch (MatrixDaemonException& exception)
+    {
+        // The client has gone away in the middle of a request.
+    }
+    catch (std::exception& exception)
+    {
+        std::cerr << "Request failed: " << exception.what() << std::endl;
+    }
+    close(connection);
+}
+
+
+/*-----=  Main  =-----*/
+
+
+/**
+ * @brief Start the workers of the parallel mode, so the first request doesn't wait for them.
+ */
+void warmWorkers()
+{
+    Matrix<int>::setParallel(true);
+    Matrix<double>::setParallel(true);
+    Matrix<Complex>::setParallel(true);
+    Matrix<int>::setWorkStealing(true);
+    Matrix<double>::setWorkStealing(true);
+    Matrix<Complex>::setWorkStealing(true);
+
+    const unsigned int cores = std::max(1u, std::thread::hardware_concurrency());
+    MatrixScheduler::shared().run(cores, cores, [](unsigned int, unsigned int)
+    {
+
+    });
+}
+
+/**
+ * @brief Remove the socket which a previous daemon left at the given address, if it is not
+ *        listened on anymore.
+ * @param address The address of the socket.
+ * @return true if the path of the address is free for a new socket, false if it is another
+ *         kind of file or a running daemon listens on it.
+ */
+bool removeStaleSocket(const sockaddr_un& address)
+{
+    struct stat status;
+    if (lstat(address.sun_path, &status) < 0)
+    {
+        return errno == ENOENT;
+    }
+    if (!S_ISSOCK(status.st_mode))
+    {
+        return false;
+    }
+
+    // A socket which nobody listens on refuses the connection.
+    const int probe = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (probe < 0)
+    {
+        return false;
+    }
+    const bool stale = connect(probe, (const sockaddr *) &address, sizeof(address)) < 0 &&
+                       errno == ECONNREFUSED;
+    close(probe);
+    return stale && unlink(address.sun_path) == 0;
+}
+
+/**
+ * @brief The main function of the program, which listens on the socket and serves each
+ *        connected client in it's own thread, until the program is killed.
+ * @param argc The number of arguments.
+ * @param argv The arguments, which are the optional path of the socket and the optional
+ *        largest number of cells in a loaded Matrix.
+ * @return EXIT_FAILURE if the arguments are invalid, if the socket path is in use (by another
+ *         kind of file or a running daemon) or if the socket cannot be opened.
+ */
+int main(int argc, char *argv[])
+{
+    if (argc > MAX_ARGUMENTS_COUNT)
+    {
+        std::cerr << USAGE_MESSAGE << std::endl;
+        return EXIT_FAILURE;
+    }
+    const std::string path = (argc > SOCKET_ARGUMENT) ? argv[SOCKET_ARGUMENT]
+                                                      : DEFAULT_DAEMON_SOCKET;
+    if (argc > CELLS_ARGUMENT)
+    {
+        char *end = nullptr;
+        maxCells = std::strtoull(argv[CELLS_ARGUMENT], &end, 10);
+        if (*end != '\0' || maxCells == 0 || argv[CELLS_ARGUMENT][0] == '-')
+        {
+            std::cerr << USAGE_MESSAGE << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(address.sun_path))
+    {
+        std::cerr << "The socket path is too long: " << path << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+
+    // A socket which is left by a previous daemon is replaced, but not a running daemon.
+    if (!removeStaleSocket(address))
+    {
+        std::cerr << "The socket path is in use: " << path << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // The socket is created with the owner permissions only, so nobody else may connect to it
+    // in the meantime.
+    const int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    const mode_t previousMask = umask(SOCKET_UMASK);
+    const bool bound = listener >= 0 &&
+                       bind(listener, (const sockaddr *) &address, sizeof(address)) == 0;
+    umask(previousMask);
+    if (!bound || listen(listener, SOMAXCONN) < 0)
+    {
+        std::cerr << "Cannot listen on " << path << ": " << std::strerror(errno) << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::signal(SIGPIPE, SIG_IGN);
+    warmWorkers();
+    std::cout << "Listening on " << path << std::endl;
+
+    while (true)
+    {
+        const int connection = accept(listener, nullptr, nullptr);
+        if (connection < 0)
+        {
+            if (errno != EINTR && errno != ECONNABORTED)
+            {
+                std::this_thread::sleep_for(
+                        std::chrono::milliseconds(ACCEPT_RETRY_MILLISECONDS));
+            }
+            continue;
+        }
+        std::thread(serve, connection).detach();
+    }
+}
@@ -0,0 +1,358 @@
+/**
+ * @file MatrixDecomposition.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 18 Oct 2026
+ *
+ * @brief A Header File for the Matrix Decomposition Classes.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the Matrix Decomposition Classes.
+ * Declaring the Decomposition Classes of a Matrix, their methods and fields.
+ * The Decompositions are meant for Matrices of double and Complex elements, and they are
+ * computed in blocks, so most of the work is done by the exact Matrix multiplication (which
+ * ignores the Mixed Precision and the Gauss Multiplication Flags) and supports it's multithread
+ * mode.
+ * Like the Matrix Class, this .h file includes it's .hpp file because these are Template Classes.
+ */
+
+
+#ifndef _MATRIXDECOMPOSITION_H
+#define _MATRIXDECOMPOSITION_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <vector>
+#include "Matrix.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def LU_BLOCK_SIZE 64
+ * @brief A Macro that sets the default number of columns in a single block of the
+ *        LU Decomposition.
+ */
+#define LU_BLOCK_SIZE 64
+
+/**
+ * @def CHOLESKY_BLOCK_SIZE 64
+ * @brief A Macro that sets the default number of columns in a single block of the
+ *        Cholesky Decomposition.
+ */
+#define CHOLESKY_BLOCK_SIZE 64
+
+/**
+ * @def QR_BLOCK_SIZE 32
+ * @brief A Macro that sets the default number of columns in a single block of the
+ *        QR Decomposition.
+ */
+#define QR_BLOCK_SIZE 32
+
+
+/*-----=  Class Definition  =-----*/
+
+
+/**
+ * @brief A Class representing the LU Decomposition (with partial pivoting) of a square Matrix,
+ *        i.e. P * A = L * U, where P is a permutation Matrix, L is a unit lower triangular
+ *        Matrix and U is an upper triangular Matrix.
+ *        The Decomposition is computed in blocks of columns. Each block is factorized directly,
+ *        and the rest of the Matrix is updated by a single Matrix multiplication.
+ */
+template <class T>
+class LUDecomposition
+{
+    static_assert(ScalarTraits<T>::floating,
+                  "Only a Matrix of floating point (or Complex) elements may be decomposed");
+
+public:
+
+    /**
+     * @brief A Constructor for a LU Decomposition which receives a square Matrix and
+     *        decomposes it.
+     *        If the given Matrix is not a square Matrix, an Exception will be thrown.
+     *        A singular Matrix is decomposed as well, but it cannot be used to solve or invert.
+     * @param matrix The Matrix to decompose.
+     * @param blockSize The number of columns in a single block of the decomposition. A block size
+     *        which is not smaller than the Matrix size performs the non-blocked decomposition.
+     */
+    LUDecomposition(const Matrix<T>& matrix, unsigned int blockSize = LU_BLOCK_SIZE);
+
+    /**
+     * @brief Determine if the decomposed Matrix is singular.
+     * @return true if the decomposed Matrix is singular, false otherwise.
+     */
+    bool isSingular() const { return _singular; };
+
+    /**
+     * @brief Returns the determinant of the decomposed Matrix.
+     * @return The determinant of the decomposed Matrix.
+     */
+    T det() const;
+
+    /**
+     * @brief Solve the linear system (A * X = b) where A is the decomposed Matrix.
+     *        If the given Matrix doesn't fit the decomposed Matrix, an Exception will be thrown.
+     *        If the decomposed Matrix is singular, an Exception will be thrown.
+     * @param b The right hand side of the linear system.
+     * @return The Matrix X which solves the linear system.
+     */
+    Matrix<T> solve(const Matrix<T>& b) const;
+
+    /**
+     * @brief Returns the inverse of the decomposed Matrix.
+     *        If the decomposed Matrix is singular, an Exception will be thrown.
+     * @return The inverse of the decomposed Matrix.
+     */
+    Matrix<T> inverse() const;
+
+    /**
+     * @brief Returns the unit lower triangular factor L of the decomposition.
+     * @return The factor L of the decomposition.
+     */
+    Matrix<T> lower() const;
+
+    /**
+     * @brief Returns the upper triangular factor U of the decomposition.
+     * @return The factor U of the decomposition.
+     */
+    Matrix<T> upper() const;
+
+    /**
+     * @brief Returns the permutation P of the decomposition, where row i of (P * A) is the
+     *        row permutation()[i] of A.
+     * @return The permutation of the decomposition.
+     */
+    std::vector<unsigned int> permutation() const;
+
+private:
+
+    /**
+     * @brief The factors L and U of the decomposition, stored in a single Matrix
+     *        (the unit diagonal of L is not stored).
+     */
+    Matrix<T> _factors;
+
+    /**
+     * @brief The pivot rows, where row i was swapped with row _pivots[i] in the i-th step.
+     */
+    std::vector<unsigned int> _pivots;
+
+    /**
+     * @brief The sign of the permutation (1 for an even number of swaps, -1 otherwise).
+     */
+    int _sign;
+
+    /**
+     * @brief A flag which determine if the decomposed Matrix is singular.
+     */
+    bool _singular;
+
+    /**
+     * @brief Factorize a single block of columns (the panel) with partial pivoting.
+     *        The rows swaps are applied to the whole Matrix.
+     * @param first The first column in the block.
+     * @param last The column after the last column in the block.
+     */
+    void _factorizePanel(unsigned int first, unsigned int last);
+
+    /**
+     * @brief Update the rows of the panel to the right of the panel (the U12 block),
+     *        by solving the unit lower triangular system of the panel.
+     * @param first The first column in the block.
+     * @param last The column after the last column in the block.
+     */
+    void _solvePanelRows(unsigned int first, unsigned int last);
+
+    /**
+     * @brief Update the trailing Matrix (below and to the right of the panel) with the
+     *        product of the panel blocks, i.e. A22 -= L21 * U12.
+     * @param first The first column in the block.
+     * @param last The column after the last column in the block.
+     */
+    void _updateTrailing(unsigned int first, unsigned int last);
+};
+
+
+/**
+ * @brief A Class representing the Cholesky Decomposition of a Hermitian (or real symmetric)
+ *        positive definite Matrix, i.e. A = L * L^H, where L is a lower triangular Matrix with
+ *        a positive real diagonal.
+ *        The Decomposition is computed in blocks of columns. Each diagonal block is factorized
+ *        directly, and the rest of the Matrix is updated by a single Matrix multiplication.
+ *        Only the lower triangle of the decomposed Matrix is read.
+ */
+template <class T>
+class CholeskyDecomposition
+{
+    static_assert(ScalarTraits<T>::floating,
+                  "Only a Matrix of floating point (or Complex) elements may be decomposed");
+
+public:
+
+    /**
+     * @brief A Constructor for a Cholesky Decomposition which receives a Matrix and
+     *        decomposes it.
+     *        If the given Matrix is not a square Matrix, or if it is not positive definite,
+     *        an Exception will be thrown.
+     * @param matrix The Matrix to decompose.
+     * @param blockSize The number of columns in a single block of the decomposition.
+     */
+    CholeskyDecomposition(const Matrix<T>& matrix, unsigned int blockSize = CHOLESKY_BLOCK_SIZE);
+
+    /**
+     * @brief Decompose the given Matrix in place, i.e. the given Matrix is overwritten with the
+     *        lower triangular factor L (and zeros above the diagonal), without allocating a copy
+     *        of it.
+     *        If the given Matrix is not a square Matrix, or if it is not positive definite,
+     *        an Exception will be thrown (and the given Matrix data is undefined).
+     * @param matrix The Matrix to decompose and overwrite.
+     * @param blockSize The number of columns in a single block of the decomposition.
+     */
+    static void factorizeInPlace(Matrix<T>& matrix, unsigned int blockSize = CHOLESKY_BLOCK_SIZE);
+
+    /**
+     * @brief Solve the linear system (L * L^H * X = b) in place, i.e. the given Matrix is
+     *        overwritten with the solution, where L is a factor computed by factorizeInPlace.
+     *        If the given Matrices doesn't fit, an Exception will be thrown.
+     * @param lower The lower triangular factor L.
+     * @param b The right hand side of the linear system, which is overwritten with the solution.
+     */
+    static void solveInPlace(const Matrix<T>& lower, Matrix<T>& b);
+
+    /**
+     * @brief Returns the lower triangular factor L of the decomposition.
+     * @return The factor L of the decomposition.
+     */
+    const Matrix<T>& lower() const { return _lower; };
+
+    /**
+     * @brief Solve the linear system (A * X = b) where A is the decomposed Matrix.
+     *        If the given Matrix doesn't fit the decomposed Matrix, an Exception will be thrown.
+     * @param b The right hand side of the linear system.
+     * @return The Matrix X which solves the linear system.
+     */
+    Matrix<T> solve(const Matrix<T>& b) const;
+
+private:
+
+    /**
+     * @brief The lower triangular factor L of the decomposition.
+     */
+    Matrix<T> _lower;
+};
+
+
+/**
+ * @brief A Class representing the QR Decomposition of a Matrix with at least as many rows as
+ *        columns, i.e. A = Q * R, where Q has orthonormal (unitary) columns and R is an upper
+ *        triangular Matrix.
+ *        The Decomposition uses Householder reflections, computed in blocks of columns. The
+ *        reflections of each block are accumulated into the compact form (I - V * T * V^H), so
+ *        the rest of the Matrix is updated by Matrix multiplications.
+ */
+template <class T>
+class QRDecomposition
+{
+    static_assert(ScalarTraits<T>::floating,
+                  "Only a Matrix of floating point (or Complex) elements may be decomposed");
+
+public:
+
+    /**
+     * @brief A Constructor for a QR Decomposition which receives a Matrix and decomposes it.
+     *        If the given Matrix has less rows than columns, an Exception will be thrown.
+     * @param matrix The Matrix to decompose.
+     * @param blockSize The number of columns in a single block of the decomposition.
+     */
+    QRDecomposition(const Matrix<T>& matrix, unsigned int blockSize = QR_BLOCK_SIZE);
+
+    /**
+     * @brief Decompose the given Matrix in place, i.e. the given Matrix is overwritten with R
+     *        on and above the diagonal, and with the Householder vectors below the diagonal,
+     *        without allocating a copy of it.
+     *        If the given Matrix has less rows than columns, an Exception will be thrown.
+     * @param matrix The Matrix to decompose and overwrite.
+     * @param blockSize The number of columns in a single block of the decomposition.
+     * @return The scaling factors of the Householder reflections.
+     */
+    static std::vector<double> factorizeInPlace(Matrix<T>& matrix,
+                                                unsigned int blockSize = QR_BLOCK_SIZE);
+
+    /**
+     * @brief Returns the upper triangular factor R of the decomposition (with as many rows as
+     *        the decomposed Matrix columns).
+     * @return The factor R of the decomposition.
+     */
+    Matrix<T> r() const;
+
+    /**
+     * @brief Returns the factor Q of the decomposition (with as many columns as the
+     *        decomposed Matrix).
+     * @return The factor Q of the decomposition.
+     */
+    Matrix<T> q() const;
+
+    /**
+     * @brief Solve the linear least squares problem (minimize |A * X - b|) where A is the
+     *        decomposed Matrix. Each column of the given Matrix is solved separately.
+     *        If the given Matrix doesn't fit the decomposed Matrix, an Exception will be thrown.
+     *        If the decomposed Matrix does not have a full rank, an Exception will be thrown.
+     * @param b The right hand side of the problem.
+     * @return The Matrix X which solves the least squares problem.
+     */
+    Matrix<T> solve(const Matrix<T>& b) const;
+
+private:
+
+    /**
+     * @brief The factors of the decomposition, R on and above the diagonal, and the
+     *        Householder vectors below the diagonal.
+     */
+    Matrix<T> _factors;
+
+    /**
+     * @brief The scaling factors of the Householder reflections.
+     */
+    std::vector<double> _scales;
+
+    /**
+     * @brief Apply the Householder reflections of the decomposition (i.e. Q^H) on the given
+     *        Matrix, which has as many rows as the decomposed Matrix.
+     * @param matrix The Matrix to apply the reflections on.
+     */
+    void _applyReflections(Matrix<T>& matrix) const;
+
+    /**
+     * @brief Factorize a single block of columns (the panel) of the given Matrix.
+     * @param matrix The Matrix to decompose.
+     * @param scales The scaling factors of the Householder reflections to fill.
+     * @param first The first column in the block.
+     * @param last The column after the last column in the block.
+     */
+    static void _factorizePanel(Matrix<T>& matrix, std::vector<double>& scales,
+                                unsigned int first, unsigned int last);
+
+    /**
+     * @brief Apply the reflections of a factorized panel on the columns to the right of it,
+     *        using the compact form of the reflections, i.e. A2 -= V * (T^H * (V^H * A2)).
+     * @param matrix The Matrix to decompose.
+     * @param scales The scaling factors of the Householder reflections.
+     * @param first The first column in the block.
+     * @param last The column after the last column in the block.
+     */
+    static void _updateTrailing(Matrix<T>& matrix, const std::vector<double>& scales,
+                                unsigned int first, unsigned int last);
+};
+
+
+#include "MatrixDecomposition.hpp"
+
+#endif
@@ -0,0 +1,941 @@
+/**
+ * @file MatrixDecomposition.hpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 18 Oct 2026
+ *
+ * @brief An implementation of the Matrix Decomposition Classes.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * An implementation of the Matrix Decomposition Classes.
+ * The Decompositions work directly on the cells of their factors Matrix, and delegate the
+ * heavy (matrix-matrix) part of each block to the Matrix multiplication, which is exact (it
+ * ignores the Mixed Precision and the Gauss Multiplication Flags) and bypasses the result cache.
+ */
+
+
+#ifndef _MATRIXDECOMPOSITION_HPP
+#define _MATRIXDECOMPOSITION_HPP
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include "MatrixDecomposition.h"
+#include "ScalarTraits.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def EVEN_PERMUTATION_SIGN 1
+ * @brief A Macro that sets the sign of a permutation with an even number of swaps.
+ */
+#define EVEN_PERMUTATION_SIGN 1
+
+/**
+ * @def MINIMAL_BLOCK_SIZE 1
+ * @brief A Macro that sets the minimal number of columns in a single block of a decomposition.
+ */
+#define MINIMAL_BLOCK_SIZE 1
+
+
+/*-----=  LU Decomposition  =-----*/
+
+
+/**
+ * @brief A Constructor for a LU Decomposition which receives a square Matrix and
+ *        decomposes it.
+ *        If the given Matrix is not a square Matrix, an Exception will be thrown.
+ *        A singular Matrix is decomposed as well, but it cannot be used to solve or invert.
+ * @param matrix The Matrix to decompose.
+ * @param blockSize The number of columns in a single block of the decomposition. A block size
+ *        which is not smaller than the Matrix size performs the non-blocked decomposition.
+ */
+template <class T>
+LUDecomposition<T>::LUDecomposition(const Matrix<T>& matrix, unsigned int blockSize)
+        : _factors(matrix), _pivots(matrix.rows()), _sign(EVEN_PERMUTATION_SIGN), _singular(false)
+{
+    if (!matrix.isSquareMatrix())
+    {
+        throw MatrixDimensionsException();
+    }
+
+    // In Copy On Write mode the factors may still share the cells of the given Matrix.
+    _factors._detach();
+    const unsigned int size = _factors._rows;
+    blockSize = std::max(blockSize, (unsigned int) MINIMAL_BLOCK_SIZE);
+    for (unsigned int first = 0; first < size; first += blockSize)
+    {
+        unsigned int last = std::min(size, first + blockSize);
+        _factorizePanel(first, last);
+        _solvePanelRows(first, last);
+        _updateTrailing(first, last);
+    }
+}
+
+/**
+ * @brief Factorize a single block of columns (the panel) with partial pivoting.
+ *        The rows swaps are applied to the whole Matrix.
+ * @param first The first column in the block.
+ * @param last The column after the last column in the block.
+ */
+template <class T>
+void LUDecomposition<T>::_factorizePanel(unsigned int first, unsigned int last)
+{
+    const unsigned int size = _factors._rows;
+    T *cells = _factors._cells.data();
+
+    for (unsigned int col = first; col < last; col++)
+    {
+        // Find the pivot, which is the largest element in the column (on or below the diagonal).
+        unsigned int pivotRow = col;
+        double pivotMagnitude = ScalarTraits<T>::abs(cells[(col * size) + col]);
+        for (unsigned int row = col + 1; row < size; row++)
+        {
+            double magnitude = ScalarTraits<T>::abs(cells[(row * size) + col]);
+            if (magnitude > pivotMagnitude)
+            {
+                pivotRow = row;
+                pivotMagnitude = magnitude;
+            }
+        }
+        _pivots[col] = pivotRow;
+
+        // If the whole column is zero there is nothing to eliminate.
+        if (pivotMagnitude == DEFAULT_VALUE)
+        {
+            _singular = true;
+            continue;
+        }
+
+        if (pivotRow != col)
+        {
+            std::swap_ranges(cells + (col * size), cells + ((col + 1) * size),
+                             cells + (pivotRow * size));
+            _sign = -_sign;
+        }
+
+        // Eliminate the column below the pivot, within the panel only.
+        const T pivot = cells[(col * size) + col];
+        for (unsigned int row = col + 1; row < size; row++)
+        {
+            T factor = ScalarTraits<T>::divide(cells[(row * size) + col], pivot);
+            cells[(row * size) + col] = factor;
+            for (unsigned int k = col + 1; k < last; k++)
+            {
+                cells[(row * size) + k] -= factor * cells[(col * size) + k];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Update the rows of the panel to the right of the panel (the U12 block),
+ *        by solving the unit lower triangular system of the panel.
+ * @param first The first column in the block.
+ * @param last The column after the last column in the block.
+ */
+template <class T>
+void LUDecomposition<T>::_solvePanelRows(unsigned int first, unsigned int last)
+{
+    const unsigned int size = _factors._rows;
+    T *cells = _factors._cells.data();
+
+    for (unsigned int col = first; col < last; col++)
+    {
+        for (unsigned int row = col + 1; row < last; row++)
+        {
+            const T factor = cells[(row * size) + col];
+            for (unsigned int k = last; k < size; k++)
+            {
+                cells[(row * size) + k] -= factor * cells[(col * size) + k];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Update the trailing Matrix (below and to the right of the panel) with the
+ *        product of the panel blocks, i.e. A22 -= L21 * U12.
+ * @param first The first column in the block.
+ * @param last The column after the last column in the block.
+ */
+template <class T>
+void LUDecomposition<T>::_updateTrailing(unsigned int first, unsigned int last)
+{
+    const unsigned int size = _factors._rows;
+    const unsigned int trailing = size - last;
+    const unsigned int width = last - first;
+    if (trailing == EMPTY_MATRIX_SIZE)
+    {
+        return;
+    }
+
+    T *cells = _factors._cells.data();
+    Matrix<T> lowerBlock(trailing, width);
+    Matrix<T> upperBlock(width, trailing);
+    for (unsigned int row = 0; row < trailing; row++)
+    {
+        std::copy(cells + ((last + row) * size) + first, cells + ((last + row) * size) + last,
+                  lowerBlock._cells.data() + (row * width));
+    }
+    for (unsigned int row = 0; row < width; row++)
+    {
+        std::copy(cells + ((first + row) * size) + last, cells + ((first + row) * size) + size,
+                  upperBlock._cells.data() + (row * trailing));
+    }
+
+    // The product is computed by the exact Matrix multiplication, in the current thread mode.
+    const Matrix<T> product = Matrix<T>::_product(lowerBlock, upperBlock, true);
+    const T *update = product._cells.data();
+    Matrix<T>::_parallelFor(trailing, [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int row = begin; row < end; row++)
+        {
+            T *destination = cells + ((last + row) * size) + last;
+            const T *source = update + (row * trailing);
+            for (unsigned int k = 0; k < trailing; k++)
+            {
+                destination[k] -= source[k];
+            }
+        }
+    });
+}
+
+/**
+ * @brief Returns the determinant of the decomposed Matrix.
+ * @return The determinant of the decomposed Matrix.
+ */
+template <class T>
+T LUDecomposition<T>::det() const
+{
+    if (_singular)
+    {
+        return T(DEFAULT_VALUE);
+    }
+
+    const unsigned int size = _factors._rows;
+    T result(_sign);
+    for (unsigned int i = 0; i < size; i++)
+    {
+        result *= _factors._cells[(i * size) + i];
+    }
+    return result;
+}
+
+/**
+ * @brief Solve the linear system (A * X = b) where A is the decomposed Matrix.
+ *        If the given Matrix doesn't fit the decomposed Matrix, an Exception will be thrown.
+ *        If the decomposed Matrix is singular, an Exception will be thrown.
+ * @param b The right hand side of the linear system.
+ * @return The Matrix X which solves the linear system.
+ */
+template <class T>
+Matrix<T> LUDecomposition<T>::solve(const Matrix<T>& b) const
+{
+    const unsigned int size = _factors._rows;
+    if (b._rows != size)
+    {
+        throw MatrixDimensionsException();
+    }
+    if (_singular)
+    {
+        throw MatrixSingularException();
+    }
+
+    Matrix<T> result(b);
+    result._detach();
+    const unsigned int cols = result._cols;
+    T *x = result._cells.data();
+    const T *factors = _factors._cells.data();
+
+    // Apply the row swaps of the decomposition.
+    for (unsigned int row = 0; row < size; row++)
+    {
+        if (_pivots[row] != row)
+        {
+            std::swap_ranges(x + (row * cols), x + ((row + 1) * cols), x + (_pivots[row] * cols));
+        }
+    }
+
+    // Each thread solves the whole system for a block of columns of the right hand side.
+    Matrix<T>::_parallelFor(cols, [&](unsigned int begin, unsigned int end)
+    {
+        // Forward substitution with the unit lower triangular factor.
+        for (unsigned int row = 1; row < size; row++)
+        {
+            for (unsigned int k = 0; k < row; k++)
+            {
+                const T factor = factors[(row * size) + k];
+                for (unsigned int col = begin; col < end; col++)
+                {
+                    x[(row * cols) + col] -= factor * x[(k * cols) + col];
+                }
+            }
+        }
+
+        // Backward substitution with the upper triangular factor.
+        for (unsigned int row = size; row-- > 0;)
+        {
+            for (unsigned int k = row + 1; k < size; k++)
+            {
+                const T factor = factors[(row * size) + k];
+                for (unsigned int col = begin; col < end; col++)
+                {
+                    x[(row * cols) + col] -= factor * x[(k * cols) + col];
+                }
+            }
+            const T pivot = factors[(row * size) + row];
+            for (unsigned int col = begin; col < end; col++)
+            {
+                x[(row * cols) + col] = ScalarTraits<T>::divide(x[(row * cols) + col], pivot);
+            }
+        }
+    });
+
+    return result;
+}
+
+/**
+ * @brief Returns the inverse of the decomposed Matrix.
+ *        If the decomposed Matrix is singular, an Exception will be thrown.
+ * @return The inverse of the decomposed Matrix.
+ */
+template <class T>
+Matrix<T> LUDecomposition<T>::inverse() const
+{
+    return solve(Matrix<T>::identity(_factors._rows));
+}
+
+/**
+ * @brief Returns the unit lower triangular factor L of the decomposition.
+ * @return The factor L of the decomposition.
+ */
+template <class T>
+Matrix<T> LUDecomposition<T>::lower() const
+{
+    const unsigned int size = _factors._rows;
+    Matrix<T> result = Matrix<T>::identity(size);
+    for (unsigned int row = 1; row < size; row++)
+    {
+        for (unsigned int col = 0; col < row; col++)
+        {
+            result._cells[(row * size) + col] = _factors._cells[(row * size) + col];
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Returns the upper triangular factor U of the decomposition.
+ * @return The factor U of the decomposition.
+ */
+template <class T>
+Matrix<T> LUDecomposition<T>::upper() const
+{
+    const unsigned int size = _factors._rows;
+    Matrix<T> result(size, size);
+    for (unsigned int row = 0; row < size; row++)
+    {
+        for (unsigned int col = row; col < size; col++)
+        {
+            result._cells[(row * size) + col] = _factors._cells[(row * size) + col];
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Returns the permutation P of the decomposition, where row i of (P * A) is the
+ *        row permutation()[i] of A.
+ * @return The permutation of the decomposition.
+ */
+template <class T>
+std::vector<unsigned int> LUDecomposition<T>::permutation() const
+{
+    std::vector<unsigned int> result(_pivots.size());
+    for (unsigned int i = 0; i < result.size(); i++)
+    {
+        result[i] = i;
+    }
+    for (unsigned int i = 0; i < result.size(); i++)
+    {
+        std::swap(result[i], result[_pivots[i]]);
+    }
+    return result;
+}
+
+
+/*-----=  Cholesky Decomposition  =-----*/
+
+
+/**
+ * @brief A Constructor for a Cholesky Decomposition which receives a Matrix and
+ *        decomposes it.
+ *        If the given Matrix is not a square Matrix, or if it is not positive definite,
+ *        an Exception will be thrown.
+ * @param matrix The Matrix to decompose.
+ * @param blockSize The number of columns in a single block of the decomposition.
+ */
+template <class T>
+CholeskyDecomposition<T>::CholeskyDecomposition(const Matrix<T>& matrix, unsigned int blockSize)
+        : _lower(matrix)
+{
+    factorizeInPlace(_lower, blockSize);
+}
+
+/**
+ * @brief Decompose the given Matrix in place, i.e. the given Matrix is overwritten with the
+ *        lower triangular factor L (and zeros above the diagonal), without allocating a copy
+ *        of it.
+ *        If the given Matrix is not a square Matrix, or if it is not positive definite,
+ *        an Exception will be thrown (and the given Matrix data is undefined).
+ * @param matrix The Matrix to decompose and overwrite.
+ * @param blockSize The number of columns in a single block of the decomposition.
+ */
+template <class T>
+void CholeskyDecomposition<T>::factorizeInPlace(Matrix<T>& matrix, unsigned int blockSize)
+{
+    if (!matrix.isSquareMatrix())
+    {
+        throw MatrixDimensionsException();
+    }
+
+    // An adopted Matrix in another layout is factorized in a packed copy.
+    if (!matrix._isPacked())
+    {
+        Matrix<T> packed(matrix);
+        factorizeInPlace(packed, blockSize);
+        matrix._unpack(packed);
+        return;
+    }
+
+    const unsigned int size = matrix._rows;
+    matrix._detach();
+    matrix._invalidateChecksum();
+    T *cells = matrix._cells.data();
+    blockSize = std::max(blockSize, (unsigned int) MINIMAL_BLOCK_SIZE);
+
+    for (unsigned int first = 0; first < size; first += blockSize)
+    {
+        const unsigned int last = std::min(size, first + blockSize);
+
+        // Factorize the diagonal block, and then the rows below it. The contributions of the
+        // previous blocks were already subtracted by their trailing updates.
+        for (unsigned int col = first; col < last; col++)
+        {
+            double diagonal = ScalarTraits<T>::real(cells[(col * size) + col]);
+            for (unsigned int k = first; k < col; k++)
+            {
+                diagonal -= ScalarTraits<T>::norm(cells[(col * size) + k]);
+            }
+            if (!(diagonal > DEFAULT_VALUE))
+            {
+                throw MatrixNotPositiveDefiniteException();
+            }
+            const T pivot(std::sqrt(diagonal));
+            cells[(col * size) + col] = pivot;
+
+            Matrix<T>::_parallelFor(size - col - 1, [&](unsigned int begin, unsigned int end)
+            {
+                for (unsigned int row = col + 1 + begin; row < col + 1 + end; row++)
+                {
+                    T value = cells[(row * size) + col];
+                    for (unsigned int k = first; k < col; k++)
+                    {
+                        value -= cells[(row * size) + k] *
+                                 ScalarTraits<T>::conj(cells[(col * size) + k]);
+                    }
+                    cells[(row * size) + col] = ScalarTraits<T>::divide(value, pivot);
+                }
+            });
+        }
+
+        // Update the trailing Matrix, i.e. A22 -= L21 * L21^H (only the lower triangle).
+        const unsigned int trailing = size - last;
+        if (trailing == EMPTY_MATRIX_SIZE)
+        {
+            continue;
+        }
+        const unsigned int width = last - first;
+        Matrix<T> panel(trailing, width);
+        for (unsigned int row = 0; row < trailing; row++)
+        {
+            std::copy(cells + ((last + row) * size) + first,
+                      cells + ((last + row) * size) + last,
+                      panel._cells.data() + (row * width));
+        }
+        const Matrix<T> product = Matrix<T>::_product(panel, panel.trans(), true);
+        const T *update = product._cells.data();
+        Matrix<T>::_parallelFor(trailing, [&](unsigned int begin, unsigned int end)
+        {
+            for (unsigned int row = begin; row < end; row++)
+            {
+                for (unsigned int col = 0; col <= row; col++)
+                {
+                    cells[((last + row) * size) + last + col] -= update[(row * trailing) + col];
+                }
+            }
+        });
+    }
+
+    // Clear the upper triangle, which holds the original data.
+    for (unsigned int row = 0; row < size; row++)
+    {
+        std::fill(cells + (row * size) + row + 1, cells + ((row + 1) * size), T(DEFAULT_VALUE));
+    }
+}
+
+/**
+ * @brief Solve the linear system (L * L^H * X = b) in place, i.e. the given Matrix is
+ *        overwritten with the solution, where L is a factor computed by factorizeInPlace.
+ *        If the given Matrices doesn't fit, an Exception will be thrown.
+ * @param lower The lower triangular factor L.
+ * @param b The right hand side of the linear system, which is overwritten with the solution.
+ */
+template <class T>
+void CholeskyDecomposition<T>::solveInPlace(const Matrix<T>& lower, Matrix<T>& b)
+{
+    const unsigned int size = lower._rows;
+    if (!lower.isSquareMatrix() || b._rows != size)
+    {
+        throw MatrixDimensionsException();
+    }
+
+    // An adopted right hand side in another layout is solved in a packed copy.
+    if (!b._isPacked())
+    {
+        Matrix<T> packed(b);
+        solveInPlace(lower, packed);
+        b._unpack(packed);
+        return;
+    }
+
+    const unsigned int cols = b._cols;
+    std::unique_ptr<Matrix<T>> scratch;
+    const T *factor = Matrix<T>::_packed(lower, scratch)._cells.data();
+    b._detach();
+    b._invalidateChecksum();
+    T *x = b._cells.data();
+
+    // Each thread solves the whole system for a block of columns of the right hand side.
+    Matrix<T>::_parallelFor(cols, [&](unsigned int begin, unsigned int end)
+    {
+        // Forward substitution with L.
+        for (unsigned int row = 0; row < size; row++)
+        {
+            for (unsigned int k = 0; k < row; k++)
+            {
+                const T coefficient = factor[(row * size) + k];
+                for (unsigned int col = begin; col < end; col++)
+                {
+                    x[(row * cols) + col] -= coefficient * x[(k * cols) + col];
+                }
+            }
+            const T pivot = factor[(row * size) + row];
+            for (unsigned int col = begin; col < end; col++)
+            {
+                x[(row * cols) + col] = ScalarTraits<T>::divide(x[(row * cols) + col], pivot);
+            }
+        }
+
+        // Backward substitution with L^H.
+        for (unsigned int row = size; row-- > 0;)
+        {
+            for (unsigned int k = row + 1; k < size; k++)
+            {
+                const T coefficient = ScalarTraits<T>::conj(factor[(k * size) + row]);
+                for (unsigned int col = begin; col < end; col++)
+                {
+                    x[(row * cols) + col] -= coefficient * x[(k * cols) + col];
+                }
+            }
+            const T pivot = factor[(row * size) + row];
+            for (unsigned int col = begin; col < end; col++)
+            {
+                x[(row * cols) + col] = ScalarTraits<T>::divide(x[(row * cols) + col], pivot);
+            }
+        }
+    });
+}
+
+/**
+ * @brief Solve the linear system (A * X = b) where A is the decomposed Matrix.
+ *        If the given Matrix doesn't fit the decomposed Matrix, an Exception will be thrown.
+ * @param b The right hand side of the linear system.
+ * @return The Matrix X which solves the linear system.
+ */
+template <class T>
+Matrix<T> CholeskyDecomposition<T>::solve(const Matrix<T>& b) const
+{
+    Matrix<T> result(b);
+    solveInPlace(_lower, result);
+    return result;
+}
+
+
+/*-----=  QR Decomposition  =-----*/
+
+
+/**
+ * @brief A Constructor for a QR Decomposition which receives a Matrix and decomposes it.
+ *        If the given Matrix has less rows than columns, an Exception will be thrown.
+ * @param matrix The Matrix to decompose.
+ * @param blockSize The number of columns in a single block of the decomposition.
+ */
+template <class T>
+QRDecomposition<T>::QRDecomposition(const Matrix<T>& matrix, unsigned int blockSize)
+        : _factors(matrix)
+{
+    _scales = factorizeInPlace(_factors, blockSize);
+}
+
+/**
+ * @brief Decompose the given Matrix in place, i.e. the given Matrix is overwritten with R
+ *        on and above the diagonal, and with the Householder vectors below the diagonal,
+ *        without allocating a copy of it.
+ *        If the given Matrix has less rows than columns, an Exception will be thrown.
+ * @param matrix The Matrix to decompose and overwrite.
+ * @param blockSize The number of columns in a single block of the decomposition.
+ * @return The scaling factors of the Householder reflections.
+ */
+template <class T>
+std::vector<double> QRDecomposition<T>::factorizeInPlace(Matrix<T>& matrix,
+                                                         unsigned int blockSize)
+{
+    if (matrix._rows < matrix._cols)
+    {
+        throw MatrixDimensionsException();
+    }
+
+    // An adopted Matrix in another layout is factorized in a packed copy.
+    if (!matrix._isPacked())
+    {
+        Matrix<T> packed(matrix);
+        std::vector<double> scales = factorizeInPlace(packed, blockSize);
+        matrix._unpack(packed);
+        return scales;
+    }
+
+    std::vector<double> scales(matrix._cols, DEFAULT_VALUE);
+    matrix._detach();
+    matrix._invalidateChecksum();
+    blockSize = std::max(blockSize, (unsigned int) MINIMAL_BLOCK_SIZE);
+    for (unsigned int first = 0; first < matrix._cols; first += blockSize)
+    {
+        unsigned int last = std::min(matrix._cols, first + blockSize);
+        _factorizePanel(matrix, scales, first, last);
+        _updateTrailing(matrix, scales, first, last);
+    }
+    return scales;
+}
+
+/**
+ * @brief Factorize a single block of columns (the panel) of the given Matrix.
+ * @param matrix The Matrix to decompose.
+ * @param scales The scaling factors of the Householder reflections to fill.
+ * @param first The first column in the block.
+ * @param last The column after the last column in the block.
+ */
+template <class T>
+void QRDecomposition<T>::_factorizePanel(Matrix<T>& matrix, std::vector<double>& scales,
+                                         unsigned int first, unsigned int last)
+{
+    const unsigned int rows = matrix._rows;
+    const unsigned int cols = matrix._cols;
+    T *cells = matrix._cells.data();
+
+    for (unsigned int col = first; col < last; col++)
+    {
+        // The reflection maps the column (on and below the diagonal) to beta * e1, where beta
+        // has the opposite phase of the diagonal element, to avoid cancellation.
+        const T alpha = cells[(col * cols) + col];
+        const double alphaMagnitude = ScalarTraits<T>::abs(alpha);
+        double columnNorm = ScalarTraits<T>::norm(alpha);
+        for (unsigned int row = col + 1; row < rows; row++)
+        {
+            columnNorm += ScalarTraits<T>::norm(cells[(row * cols) + col]);
+        }
+        columnNorm = std::sqrt(columnNorm);
+        if (columnNorm == DEFAULT_VALUE)
+        {
+            continue;
+        }
+
+        T phase(IDENTITY_VALUE);
+        if (alphaMagnitude != DEFAULT_VALUE)
+        {
+            phase = ScalarTraits<T>::divide(alpha, T(alphaMagnitude));
+        }
+        const T beta = phase * T(-columnNorm);
+        const T pivot = alpha - beta;
+        for (unsigned int row = col + 1; row < rows; row++)
+        {
+            cells[(row * cols) + col] = ScalarTraits<T>::divide(cells[(row * cols) + col], pivot);
+        }
+        cells[(col * cols) + col] = beta;
+        const double scale = (columnNorm + alphaMagnitude) / columnNorm;
+        scales[col] = scale;
+
+        // Apply the reflection (I - scale * v * v^H) on the rest of the panel.
+        for (unsigned int k = col + 1; k < last; k++)
+        {
+            T projection = cells[(col * cols) + k];
+            for (unsigned int row = col + 1; row < rows; row++)
+            {
+                projection += ScalarTraits<T>::conj(cells[(row * cols) + col]) *
+                              cells[(row * cols) + k];
+            }
+            projection *= T(scale);
+            cells[(col * cols) + k] -= projection;
+            for (unsigned int row = col + 1; row < rows; row++)
+            {
+                cells[(row * cols) + k] -= cells[(row * cols) + col] * projection;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Apply the reflections of a factorized panel on the columns to the right of it,
+ *        using the compact form of the reflections, i.e. A2 -= V * (T^H * (V^H * A2)).
+ * @param matrix The Matrix to decompose.
+ * @param scales The scaling factors of the Householder reflections.
+ * @param first The first column in the block.
+ * @param last The column after the last column in the block.
+ */
+template <class T>
+void QRDecomposition<T>::_updateTrailing(Matrix<T>& matrix, const std::vector<double>& scales,
+                                         unsigned int first, unsigned int last)
+{
+    const unsigned int rows = matrix._rows;
+    const unsigned int cols = matrix._cols;
+    const unsigned int height = rows - first;
+    const unsigned int width = last - first;
+    const unsigned int trailing = cols - last;
+    if (trailing == EMPTY_MATRIX_SIZE)
+    {
+        return;
+    }
+    T *cells = matrix._cells.data();
+
+    // Gather the Householder vectors of the panel (with their implicit unit diagonal).
+    Matrix<T> vectors(height, width);
+    for (unsigned int col = 0; col < width; col++)
+    {
+        vectors._cells[(col * width) + col] = T(IDENTITY_VALUE);
+        for (unsigned int row = col + 1; row < height; row++)
+        {
+            vectors._cells[(row * width) + col] = cells[((first + row) * cols) + first + col];
+        }
+    }
+
+    // Accumulate the upper triangular factor T of the compact form, one column at a time:
+    // T(0:i, i) = -scale_i * T(0:i, 0:i) * V(:, 0:i)^H * v_i.
+    const Matrix<T> gram = Matrix<T>::_product(vectors.trans(), vectors, true);
+    Matrix<T> factor(width, width);
+    for (unsigned int col = 0; col < width; col++)
+    {
+        const T scale(scales[first + col]);
+        factor._cells[(col * width) + col] = scale;
+        for (unsigned int row = 0; row < col; row++)
+        {
+            T value(DEFAULT_VALUE);
+            for (unsigned int k = row; k < col; k++)
+            {
+                value += factor._cells[(row * width) + k] * gram._cells[(k * width) + col];
+            }
+            factor._cells[(row * width) + col] = T(-scales[first + col]) * value;
+        }
+    }
+
+    // The level-3 update of the trailing columns.
+    Matrix<T> block(height, trailing);
+    for (unsigned int row = 0; row < height; row++)
+    {
+        std::copy(cells + ((first + row) * cols) + last, cells + ((first + row) * cols) + cols,
+                  block._cells.data() + (row * trailing));
+    }
+    const Matrix<T> projection = Matrix<T>::_product(vectors.trans(), block, true);
+    const Matrix<T> update = Matrix<T>::_product(
+            vectors, Matrix<T>::_product(factor.trans(), projection, true), true);
+    Matrix<T>::_parallelFor(height, [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int row = begin; row < end; row++)
+        {
+            T *destination = cells + ((first + row) * cols) + last;
+            const T *source = update._cells.data() + (row * trailing);
+            for (unsigned int k = 0; k < trailing; k++)
+            {
+                destination[k] -= source[k];
+            }
+        }
+    });
+}
+
+/**
+ * @brief Apply the Householder reflections of the decomposition (i.e. Q^H) on the given
+ *        Matrix, which has as many rows as the decomposed Matrix.
+ * @param matrix The Matrix to apply the reflections on.
+ */
+template <class T>
+void QRDecomposition<T>::_applyReflections(Matrix<T>& matrix) const
+{
+    const unsigned int rows = _factors._rows;
+    const unsigned int cols = _factors._cols;
+    const unsigned int targetCols = matrix._cols;
+    const T *vectors = _factors._cells.data();
+    matrix._detach();
+    matrix._invalidateChecksum();
+    T *target = matrix._cells.data();
+
+    Matrix<T>::_parallelFor(targetCols, [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int col = 0; col < cols; col++)
+        {
+            const T scale(_scales[col]);
+            for (unsigned int k = begin; k < end; k++)
+            {
+                T projection = target[(col * targetCols) + k];
+                for (unsigned int row = col + 1; row < rows; row++)
+                {
+                    projection += ScalarTraits<T>::conj(vectors[(row * cols) + col]) *
+                                  target[(row * targetCols) + k];
+                }
+                projection *= scale;
+                target[(col * targetCols) + k] -= projection;
+                for (unsigned int row = col + 1; row < rows; row++)
+                {
+                    target[(row * targetCols) + k] -= vectors[(row * cols) + col] * projection;
+                }
+            }
+        }
+    });
+}
+
+/**
+ * @brief Returns the upper triangular factor R of the decomposition (with as many rows as
+ *        the decomposed Matrix columns).
+ * @return The factor R of the decomposition.
+ */
+template <class T>
+Matrix<T> QRDecomposition<T>::r() const
+{
+    const unsigned int cols = _factors._cols;
+    Matrix<T> result(cols, cols);
+    for (unsigned int row = 0; row < cols; row++)
+    {
+        std::copy(_factors._cells.data() + (row * cols) + row,
+                  _factors._cells.data() + ((row + 1) * cols),
+                  result._cells.data() + (row * cols) + row);
+    }
+    return result;
+}
+
+/**
+ * @brief Returns the factor Q of the decomposition (with as many columns as the
+ *        decomposed Matrix).
+ * @return The factor Q of the decomposition.
+ */
+template <class T>
+Matrix<T> QRDecomposition<T>::q() const
+{
+    // Q is the product of the reflections, applied in reverse order on the identity columns.
+    const unsigned int rows = _factors._rows;
+    const unsigned int cols = _factors._cols;
+    Matrix<T> result(rows, cols);
+    T *target = result._cells.data();
+    const T *vectors = _factors._cells.data();
+    for (unsigned int i = 0; i < cols; i++)
+    {
+        target[(i * cols) + i] = T(IDENTITY_VALUE);
+    }
+
+    Matrix<T>::_parallelFor(cols, [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int col = cols; col-- > 0;)
+        {
+            const T scale(_scales[col]);
+            for (unsigned int k = begin; k < end; k++)
+            {
+                T projection = target[(col * cols) + k];
+                for (unsigned int row = col + 1; row < rows; row++)
+                {
+                    projection += ScalarTraits<T>::conj(vectors[(row * cols) + col]) *
+                                  target[(row * cols) + k];
+                }
+                projection *= scale;
+                target[(col * cols) + k] -= projection;
+                for (unsigned int row = col + 1; row < rows; row++)
+                {
+                    target[(row * cols) + k] -= vectors[(row * cols) + col] * projection;
+                }
+            }
+        }
+    });
+    return result;
+}
+
+/**
+ * @brief Solve the linear least squares problem (minimize |A * X - b|) where A is the
+ *        decomposed Matrix. Each column of the given Matrix is solved separately.
+ *        If the given Matrix doesn't fit the decomposed Matrix, an Exception will be thrown.
+ *        If the decomposed Matrix does not have a full rank, an Exception will be thrown.
+ * @param b The right hand side of the problem.
+ * @return The Matrix X which solves the least squares problem.
+ */
+template <class T>
+Matrix<T> QRDecomposition<T>::solve(const Matrix<T>& b) const
+{
+    const unsigned int cols = _factors._cols;
+    if (b._rows != _factors._rows)
+    {
+        throw MatrixDimensionsException();
+    }
+    for (unsigned int i = 0; i < cols; i++)
+    {
+        if (ScalarTraits<T>::abs(_factors._cells[(i * cols) + i]) == DEFAULT_VALUE)
+        {
+            throw MatrixSingularException();
+        }
+    }
+
+    Matrix<T> projected(b);
+    _applyReflections(projected);
+
+    // Backward substitution with R on the first rows of (Q^H * b).
+    const unsigned int targetCols = b._cols;
+    Matrix<T> result(cols, targetCols);
+    T *x = result._cells.data();
+    std::copy(projected._cells.data(), projected._cells.data() + (cols * targetCols), x);
+    const T *factors = _factors._cells.data();
+    Matrix<T>::_parallelFor(targetCols, [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int row = cols; row-- > 0;)
+        {
+            for (unsigned int k = row + 1; k < cols; k++)
+            {
+                const T coefficient = factors[(row * cols) + k];
+                for (unsigned int col = begin; col < end; col++)
+                {
+                    x[(row * targetCols) + col] -= coefficient * x[(k * targetCols) + col];
+                }
+            }
+            const T pivot = factors[(row * cols) + row];
+            for (unsigned int col = begin; col < end; col++)
+            {
+                x[(row * targetCols) + col] = ScalarTraits<T>::divide(x[(row * targetCols) + col],
+                                                                      pivot);
+            }
+        }
+    });
+    return result;
+}
+
+#endif
@@ -48,6 +48,55 @@
  */
 #define INDEX_EXCEPTION_MESSAGE "Attempt to reach an invalid index in the Matrix."
 
+/**
+ * @def SINGULAR_EXCEPTION_MESSAGE "The matrix is singular."
+ * @brief A Macro that sets the Exception Message for an operation which requires an invertible
+ *        Matrix.
+ */
+#define SINGULAR_EXCEPTION_MESSAGE "The matrix is singular."
+
+/**
+ * @def POSITIVE_DEFINITE_EXCEPTION_MESSAGE "The matrix is not positive definite."
+ * @brief A Macro that sets the Exception Message for an operation which requires a positive
+ *        definite Matrix.
+ */
+#define POSITIVE_DEFINITE_EXCEPTION_MESSAGE "The matrix is not positive definite."
+
+/**
+ * @def STRUCTURE_EXCEPTION_MESSAGE "The cells of the matrix don't fit it's structure."
+ * @brief A Macro that sets the Exception Message for a cell which a Structured Matrix cannot
+ *        hold (e.g. a diagonal cell of a Hermitian Matrix which is not real).
+ */
+#define STRUCTURE_EXCEPTION_MESSAGE "The cells of the matrix don't fit it's structure."
+
+/**
+ * @def FILE_EXCEPTION_MESSAGE "Failed to access the matrix file."
+ * @brief A Macro that sets the Exception Message for a failure in reading or writing the file
+ *        of a Matrix which is stored on the disk.
+ */
+#define FILE_EXCEPTION_MESSAGE "Failed to access the matrix file."
+
+/**
+ * @def OVERFLOW_EXCEPTION_MESSAGE "The result of the matrix operation overflows it's type."
+ * @brief A Macro that sets the Exception Message for an operation which result doesn't fit the
+ *        element type of the Matrix.
+ */
+#define OVERFLOW_EXCEPTION_MESSAGE "The result of the matrix operation overflows it's type."
+
+/**
+ * @def DAEMON_EXCEPTION_MESSAGE "Failed to communicate with the matrix daemon."
+ * @brief A Macro that sets the Exception Message for a failure in a request to the Matrix
+ *        Daemon.
+ */
+#define DAEMON_EXCEPTION_MESSAGE "Failed to communicate with the matrix daemon."
+
+/**
+ * @def NAME_EXCEPTION_MESSAGE "The matrix daemon has no matrix with this name."
+ * @brief A Macro that sets the Exception Message for a request to the Matrix Daemon which
+ *        refers to a Matrix that it doesn't hold.
+ */
+#define NAME_EXCEPTION_MESSAGE "The matrix daemon has no matrix with this name."
+
 
 /*-----=  Class Definition  =-----*/
 
@@ -98,4 +147,119 @@ public:
 };
 
 
+/**
+ * @brief A Matrix Exception Class for an operation which requires an invertible Matrix
+ *        (e.g. solving a linear system or inverting) and was given a singular Matrix.
+ */
+class MatrixSingularException : public MatrixException
+{
+public:
+
+    /**
+     * @brief Describe the error that occured when this Exception was thrown.
+     * @return An informative message about the Exception.
+     */
+    virtual const char * what() const throw() override { return SINGULAR_EXCEPTION_MESSAGE; };
+};
+
+
+/**
+ * @brief A Matrix Exception Class for an operation which requires a Hermitian positive definite
+ *        Matrix (e.g. the Cholesky Decomposition) and was given a Matrix which is not.
+ */
+class MatrixNotPositiveDefiniteException : public MatrixException
+{
+public:
+
+    /**
+     * @brief Describe the error that occured when this Exception was thrown.
+     * @return An informative message about the Exception.
+     */
+    virtual const char * what() const throw() override
+    {
+        return POSITIVE_DEFINITE_EXCEPTION_MESSAGE;
+    };
+};
+
+
+/**
+ * @brief A Matrix Exception Class for a cell which a Structured Matrix cannot hold (e.g. a
+ *        diagonal cell of a HERMITIAN Matrix which is not real).
+ */
+class MatrixStructureException : public MatrixException
+{
+public:
+
+    /**
+     * @brief Describe the error that occured when this Exception was thrown.
+     * @return An informative message about the Exception.
+     */
+    virtual const char * what() const throw() override { return STRUCTURE_EXCEPTION_MESSAGE; };
+};
+
+
+/**
+ * @brief A Matrix Exception Class for a failure in reading or writing the file of a Matrix which
+ *        is stored on the disk.
+ */
+class MatrixFileException : public MatrixException
+{
+public:
+
+    /**
+     * @brief Describe the error that occured when this Exception was thrown.
+     * @return An informative message about the Exception.
+     */
+    virtual const char * what() const throw() override { return FILE_EXCEPTION_MESSAGE; };
+};
+
+
+/**
+ * @brief A Matrix Exception Class for an operation which result doesn't fit the element type of
+ *        the Matrix (e.g. a product of int Matrices with a cell larger than an int).
+ */
+class MatrixOverflowException : public MatrixException
+{
+public:
+
+    /**
+     * @brief Describe the error that occured when this Exception was thrown.
+     * @return An informative message about the Exception.
+     */
+    virtual const char * what() const throw() override { return OVERFLOW_EXCEPTION_MESSAGE; };
+};
+
+
+/**
+ * @brief A Matrix Exception Class for a failure in a request to the Matrix Daemon (e.g. the
+ *        daemon isn't running, or it has rejected the request).
+ */
+class MatrixDaemonException : public MatrixException
+{
+public:
+
+    /**
+     * @brief Describe the error that occured when this Exception was thrown.
+     * @return An informative message about the Exception.
+     */
+    virtual const char * what() const throw() override { return DAEMON_EXCEPTION_MESSAGE; };
+};
+
+
+/**
+ * @brief A Matrix Exception Class for a request to the Matrix Daemon which refers to a Matrix
+ *        that it doesn't hold.
+ */
+class MatrixNameException : public MatrixException
+{
+public:
+
+    /**
+     * @brief Describe the error that occured when this Exception was thrown.
+     * @return An informative message about the Exception.
+     */
+    virtual const char * what() const throw() override { return NAME_EXCEPTION_MESSAGE; };
+};
+
+
 #endif
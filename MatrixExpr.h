@@ -0,0 +1,307 @@
+/**
+ * @file MatrixExpr.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 18 Oct 2026
+ *
+ * @brief A Header File for the Matrix Expression Graph and Matrix Expression Classes.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the Matrix Expression Graph and Matrix Expression Classes.
+ * A Matrix Expression is a lazy Matrix operation (addition, subtraction, multiplication or
+ * Transpose) which is recorded in a Matrix Expression Graph instead of being computed.
+ * The graph keeps a single node for every distinct expression, so a subexpression which is
+ * written several times (e.g. A.trans() used twice) is computed once.
+ * On evaluation, every chain of multiplications is reordered to the cheapest order for the
+ * dimensions of it's factors, and the nodes are computed by the shared Matrix Thread Pool, so
+ * independent nodes run in parallel.
+ */
+
+
+#ifndef _MATRIXEXPR_H
+#define _MATRIXEXPR_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <vector>
+#include <map>
+#include <tuple>
+#include "Matrix.h"
+
+
+/*-----=  Class Definitions  =-----*/
+
+
+template <class T>
+class MatrixExprGraph;
+
+
+/**
+ * @brief A Class representing a lazy Matrix expression in a Matrix Expression Graph.
+ *        The dimensions of the operands are checked when the expression is built, so an
+ *        invalid expression throws an Exception immediately.
+ *        An expression is valid as long as it's graph exists.
+ */
+template <class T>
+class MatrixExpr
+{
+public:
+
+    /**
+     * @brief Returns the number of rows in the result of the expression.
+     * @return The number of rows in the result.
+     */
+    unsigned int rows() const;
+
+    /**
+     * @brief Returns the number of columns in the result of the expression.
+     * @return The number of columns in the result.
+     */
+    unsigned int cols() const;
+
+    /**
+     * @brief Returns the expression of the sum of this expression and the given expression.
+     *        If the dimensions doesn't fit, an Exception will be thrown.
+     * @param other The expression to add to this expression.
+     * @return The expression of the sum.
+     */
+    MatrixExpr<T> operator+(const MatrixExpr<T>& other) const;
+
+    /**
+     * @brief Returns the expression of the difference of this expression and the given
+     *        expression. If the dimensions doesn't fit, an Exception will be thrown.
+     * @param other The expression to subtract from this expression.
+     * @return The expression of the difference.
+     */
+    MatrixExpr<T> operator-(const MatrixExpr<T>& other) const;
+
+    /**
+     * @brief Returns the expression of the product of this expression and the given expression.
+     *        If the dimensions doesn't fit, an Exception will be thrown.
+     * @param other The expression to multiply this expression by (on the right side).
+     * @return The expression of the product.
+     */
+    MatrixExpr<T> operator*(const MatrixExpr<T>& other) const;
+
+    /**
+     * @brief Returns the expression of the Transpose of this expression.
+     * @return The expression of the Transpose.
+     */
+    MatrixExpr<T> trans() const;
+
+private:
+
+    friend class MatrixExprGraph<T>;
+
+    /**
+     * @brief The graph of the expression.
+     */
+    MatrixExprGraph<T> *_graph;
+
+    /**
+     * @brief The node of the expression in it's graph.
+     */
+    unsigned int _node;
+
+    /**
+     * @brief A Constructor for an expression of the given node in the given graph.
+     * @param graph The graph of the expression.
+     * @param node The node of the expression.
+     */
+    MatrixExpr(MatrixExprGraph<T> *graph, unsigned int node);
+};
+
+
+/**
+ * @brief A Class representing a graph of lazy Matrix expressions, in which identical
+ *        subexpressions share a single node.
+ *        A graph cannot be copied, because it's expressions refer to it.
+ */
+template <class T>
+class MatrixExprGraph
+{
+public:
+
+    /**
+     * @brief A Constructor for an empty graph.
+     */
+    MatrixExprGraph() { };
+
+    /**
+     * @brief Returns an expression for (a copy of) the given Matrix.
+     *        Every call creates a new input, so an input which is used several times should be
+     *        created once and it's expression reused.
+     * @param matrix The input Matrix.
+     * @return The expression of the input.
+     */
+    MatrixExpr<T> input(const Matrix<T>& matrix);
+
+    /**
+     * @brief Returns the number of distinct nodes in the graph.
+     * @return The number of nodes in the graph.
+     */
+    unsigned int size() const { return (unsigned int) _nodes.size(); };
+
+    /**
+     * @brief Compute the given expression.
+     * @param expr The expression to compute.
+     * @return The result of the expression.
+     */
+    Matrix<T> evaluate(const MatrixExpr<T>& expr);
+
+    /**
+     * @brief Compute the given expressions together, so a node which is shared by several
+     *        expressions is computed once.
+     * @param exprs The expressions to compute.
+     * @return The results of the expressions, in the same order.
+     */
+    std::vector<Matrix<T>> evaluate(const std::vector<MatrixExpr<T>>& exprs);
+
+private:
+
+    friend class MatrixExpr<T>;
+
+    /**
+     * @brief The operations of the nodes.
+     */
+    enum _Operation { INPUT, ADD, SUBTRACT, MULTIPLY, TRANSPOSE };
+
+    /**
+     * @brief A node of the graph.
+     */
+    struct _Node
+    {
+        /**
+         * @brief The operation of the node.
+         */
+        _Operation operation;
+
+        /**
+         * @brief The first operand of the node (or the index of the input of an input node).
+         */
+        unsigned int first;
+
+        /**
+         * @brief The second operand of the node (unused by unary nodes).
+         */
+        unsigned int second;
+
+        /**
+         * @brief The number of rows in the result of the node.
+         */
+        unsigned int rows;
+
+        /**
+         * @brief The number of columns in the result of the node.
+         */
+        unsigned int cols;
+    };
+
+    /**
+     * @brief The nodes of the graph.
+     */
+    std::vector<_Node> _nodes;
+
+    /**
+     * @brief The input Matrices, as ready Futures.
+     */
+    std::vector<MatrixFuture<T>> _inputs;
+
+    /**
+     * @brief The node of each distinct (operation, first, second) triple.
+     */
+    std::map<std::tuple<int, unsigned int, unsigned int>, unsigned int> _table;
+
+    /**
+     * @brief A graph cannot be copied, because it's expressions refer to it.
+     */
+    MatrixExprGraph(const MatrixExprGraph<T>& other) = delete;
+
+    /**
+     * @brief A graph cannot be assigned, because it's expressions refer to it.
+     */
+    MatrixExprGraph<T>& operator=(const MatrixExprGraph<T>& other) = delete;
+
+    /**
+     * @brief Returns the node of the given operation on the given operands, checking the
+     *        dimensions of the operands and simplifying a double Transpose.
+     *        If the dimensions doesn't fit, an Exception will be thrown.
+     * @param operation The operation of the node.
+     * @param first The first operand.
+     * @param second The second operand (unused by a Transpose).
+     * @return The node of the operation.
+     */
+    unsigned int _apply(_Operation operation, unsigned int first, unsigned int second);
+
+    /**
+     * @brief Returns the node of the given operation on the given operands, creating it only
+     *        if the graph doesn't have it already.
+     * @param operation The operation of the node.
+     * @param first The first operand.
+     * @param second The second operand.
+     * @param rows The number of rows in the result of the node.
+     * @param cols The number of columns in the result of the node.
+     * @return The node of the operation.
+     */
+    unsigned int _intern(_Operation operation, unsigned int first, unsigned int second,
+                         unsigned int rows, unsigned int cols);
+
+    /**
+     * @brief Count the uses of every node which is reachable from the given node.
+     * @param node The node to start from.
+     * @param uses The number of uses of each node, which is updated.
+     * @param visited A flag for each node which was already counted, which is updated.
+     */
+    void _countUses(unsigned int node, std::vector<unsigned int>& uses,
+                    std::vector<bool>& visited) const;
+
+    /**
+     * @brief Collect the factors of the chain of multiplications of the given node. A product
+     *        which is used more than once is kept as a single factor, so it is still shared.
+     * @param node The node of the chain.
+     * @param uses The number of uses of each node.
+     * @param factors The factors of the chain, in order, which are updated.
+     */
+    void _collectFactors(unsigned int node, const std::vector<unsigned int>& uses,
+                         std::vector<unsigned int>& factors) const;
+
+    /**
+     * @brief Returns the node of the product of the given factors, in the order which performs
+     *        the least scalar multiplications (by the classic matrix-chain dynamic programming).
+     * @param factors The factors of the chain, in order.
+     * @return The node of the product.
+     */
+    unsigned int _orderChain(const std::vector<unsigned int>& factors);
+
+    /**
+     * @brief Returns the node which computes the given node with all it's chains of
+     *        multiplications reordered.
+     * @param node The node to rewrite.
+     * @param uses The number of uses of each node.
+     * @param rewritten The rewritten node of each node which was already rewritten, which is
+     *        updated.
+     * @return The rewritten node.
+     */
+    unsigned int _rewrite(unsigned int node, const std::vector<unsigned int>& uses,
+                          std::map<unsigned int, unsigned int>& rewritten);
+
+    /**
+     * @brief Returns the Future of the given node, scheduling it (and the nodes it depends on)
+     *        on the shared Matrix Thread Pool if it was not scheduled yet.
+     * @param node The node to schedule.
+     * @param futures The Future of each node which was already scheduled, which is updated.
+     * @return The Future of the node.
+     */
+    MatrixFuture<T> _schedule(unsigned int node,
+                              std::map<unsigned int, MatrixFuture<T>>& futures) const;
+};
+
+
+#include "MatrixExpr.hpp"
+
+#endif
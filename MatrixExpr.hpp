@@ -0,0 +1,480 @@
+/**
+ * @file MatrixExpr.hpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 18 Oct 2026
+ *
+ * @brief An implementation of the Matrix Expression Graph and Matrix Expression Classes.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * An implementation of the Matrix Expression Graph and Matrix Expression Classes.
+ * The evaluation has two passes: the rewrite pass replaces every chain of multiplications by
+ * it's cheapest ordering (the new products are added to the graph, so they are shared as
+ * well), and the scheduling pass turns every node which is needed into an asynchronous
+ * operation which depends on the operations of it's operands.
+ */
+
+
+#ifndef _MATRIXEXPR_HPP
+#define _MATRIXEXPR_HPP
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include "MatrixExpr.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def NO_OPERAND 0
+ * @brief A Macro that sets the operand of a node which doesn't use it.
+ */
+#define NO_OPERAND 0
+
+/**
+ * @def SINGLE_USE 1
+ * @brief A Macro that sets the number of uses of a node which is used by a single expression.
+ */
+#define SINGLE_USE 1
+
+
+/*-----=  Matrix Expression Methods  =-----*/
+
+
+/**
+ * @brief A Constructor for an expression of the given node in the given graph.
+ * @param graph The graph of the expression.
+ * @param node The node of the expression.
+ */
+template <class T>
+MatrixExpr<T>::MatrixExpr(MatrixExprGraph<T> *graph, unsigned int node)
+        : _graph(graph), _node(node)
+{
+
+}
+
+/**
+ * @brief Returns the number of rows in the result of the expression.
+ * @return The number of rows in the result.
+ */
+template <class T>
+unsigned int MatrixExpr<T>::rows() const
+{
+    return _graph -> _nodes[_node].rows;
+}
+
+/**
+ * @brief Returns the number of columns in the result of the expression.
+ * @return The number of columns in the result.
+ */
+template <class T>
+unsigned int MatrixExpr<T>::cols() const
+{
+    return _graph -> _nodes[_node].cols;
+}
+
+/**
+ * @brief Returns the expression of the sum of this expression and the given expression.
+ *        If the dimensions doesn't fit, an Exception will be thrown.
+ * @param other The expression to add to this expression.
+ * @return The expression of the sum.
+ */
+template <class T>
+MatrixExpr<T> MatrixExpr<T>::operator+(const MatrixExpr<T>& other) const
+{
+    assert(_graph == other._graph);
+    return MatrixExpr<T>(_graph, _graph -> _apply(MatrixExprGraph<T>::ADD, _node, other._node));
+}
+
+/**
+ * @brief Returns the expression of the difference of this expression and the given
+ *        expression. If the dimensions doesn't fit, an Exception will be thrown.
+ * @param other The expression to subtract from this expression.
+ * @return The expression of the difference.
+ */
+template <class T>
+MatrixExpr<T> MatrixExpr<T>::operator-(const MatrixExpr<T>& other) const
+{
+    assert(_graph == other._graph);
+    return MatrixExpr<T>(_graph, _graph -> _apply(MatrixExprGraph<T>::SUBTRACT, _node,
+                                                  other._node));
+}
+
+/**
+ * @brief Returns the expression of the product of this expression and the given expression.
+ *        If the dimensions doesn't fit, an Exception will be thrown.
+ * @param other The expression to multiply this expression by (on the right side).
+ * @return The expression of the product.
+ */
+template <class T>
+MatrixExpr<T> MatrixExpr<T>::operator*(const MatrixExpr<T>& other) const
+{
+    assert(_graph == other._graph);
+    return MatrixExpr<T>(_graph, _graph -> _apply(MatrixExprGraph<T>::MULTIPLY, _node,
+                                                  other._node));
+}
+
+/**
+ * @brief Returns the expression of the Transpose of this expression.
+ * @return The expression of the Transpose.
+ */
+template <class T>
+MatrixExpr<T> MatrixExpr<T>::trans() const
+{
+    return MatrixExpr<T>(_graph, _graph -> _apply(MatrixExprGraph<T>::TRANSPOSE, _node,
+                                                  NO_OPERAND));
+}
+
+
+/*-----=  Building the Graph  =-----*/
+
+
+/**
+ * @brief Returns an expression for (a copy of) the given Matrix.
+ *        Every call creates a new input, so an input which is used several times should be
+ *        created once and it's expression reused.
+ * @param matrix The input Matrix.
+ * @return The expression of the input.
+ */
+template <class T>
+MatrixExpr<T> MatrixExprGraph<T>::input(const Matrix<T>& matrix)
+{
+    _inputs.push_back(MatrixFuture<T>(matrix));
+    _Node node = {INPUT, (unsigned int) _inputs.size() - 1, NO_OPERAND, matrix.rows(),
+                  matrix.cols()};
+    _nodes.push_back(node);
+    return MatrixExpr<T>(this, (unsigned int) _nodes.size() - 1);
+}
+
+/**
+ * @brief Returns the node of the given operation on the given operands, checking the
+ *        dimensions of the operands and simplifying a double Transpose.
+ *        If the dimensions doesn't fit, an Exception will be thrown.
+ * @param operation The operation of the node.
+ * @param first The first operand.
+ * @param second The second operand (unused by a Transpose).
+ * @return The node of the operation.
+ */
+template <class T>
+unsigned int MatrixExprGraph<T>::_apply(_Operation operation, unsigned int first,
+                                        unsigned int second)
+{
+    const _Node firstNode = _nodes[first];
+    switch (operation)
+    {
+        case TRANSPOSE:
+            // The Transpose (and the conjugate Transpose) is an involution.
+            if (firstNode.operation == TRANSPOSE)
+            {
+                return firstNode.first;
+            }
+            return _intern(TRANSPOSE, first, NO_OPERAND, firstNode.cols, firstNode.rows);
+
+        case MULTIPLY:
+            if (firstNode.cols != _nodes[second].rows)
+            {
+                throw MatrixDimensionsException();
+            }
+            return _intern(MULTIPLY, first, second, firstNode.rows, _nodes[second].cols);
+
+        default:
+            if (firstNode.rows != _nodes[second].rows || firstNode.cols != _nodes[second].cols)
+            {
+                throw MatrixDimensionsException();
+            }
+            // The addition is commutative, so both orders share a node.
+            if (operation == ADD && second < first)
+            {
+                std::swap(first, second);
+            }
+            return _intern(operation, first, second, firstNode.rows, firstNode.cols);
+    }
+}
+
+/**
+ * @brief Returns the node of the given operation on the given operands, creating it only
+ *        if the graph doesn't have it already.
+ * @param operation The operation of the node.
+ * @param first The first operand.
+ * @param second The second operand.
+ * @param rows The number of rows in the result of the node.
+ * @param cols The number of columns in the result of the node.
+ * @return The node of the operation.
+ */
+template <class T>
+unsigned int MatrixExprGraph<T>::_intern(_Operation operation, unsigned int first,
+                                         unsigned int second, unsigned int rows,
+                                         unsigned int cols)
+{
+    std::tuple<int, unsigned int, unsigned int> key(operation, first, second);
+    typename std::map<std::tuple<int, unsigned int, unsigned int>, unsigned int>::iterator
+            existing = _table.find(key);
+    if (existing != _table.end())
+    {
+        return existing -> second;
+    }
+
+    _Node node = {operation, first, second, rows, cols};
+    _nodes.push_back(node);
+    _table[key] = (unsigned int) _nodes.size() - 1;
+    return (unsigned int) _nodes.size() - 1;
+}
+
+
+/*-----=  Evaluation  =-----*/
+
+
+/**
+ * @brief Compute the given expression.
+ * @param expr The expression to compute.
+ * @return The result of the expression.
+ */
+template <class T>
+Matrix<T> MatrixExprGraph<T>::evaluate(const MatrixExpr<T>& expr)
+{
+    return evaluate(std::vector<MatrixExpr<T>>(1, expr))[0];
+}
+
+/**
+ * @brief Compute the given expressions together, so a node which is shared by several
+ *        expressions is computed once.
+ * @param exprs The expressions to compute.
+ * @return The results of the expressions, in the same order.
+ */
+template <class T>
+std::vector<Matrix<T>> MatrixExprGraph<T>::evaluate(const std::vector<MatrixExpr<T>>& exprs)
+{
+    // Every expression is a use of it's node, so a requested product is never folded.
+    std::vector<unsigned int> uses(_nodes.size(), 0);
+    std::vector<bool> visited(_nodes.size(), false);
+    for (const MatrixExpr<T>& expr : exprs)
+    {
+        assert(expr._graph == this);
+        uses[expr._node]++;
+        _countUses(expr._node, uses, visited);
+    }
+
+    std::map<unsigned int, unsigned int> rewritten;
+    std::vector<unsigned int> roots;
+    for (const MatrixExpr<T>& expr : exprs)
+    {
+        roots.push_back(_rewrite(expr._node, uses, rewritten));
+    }
+
+    // All the nodes are scheduled before waiting, so independent nodes run in parallel.
+    std::map<unsigned int, MatrixFuture<T>> futures;
+    std::vector<MatrixFuture<T>> results;
+    for (unsigned int root : roots)
+    {
+        results.push_back(_schedule(root, futures));
+    }
+
+    std::vector<Matrix<T>> values;
+    for (const MatrixFuture<T>& result : results)
+    {
+        values.push_back(result.get());
+    }
+    return values;
+}
+
+/**
+ * @brief Count the uses of every node which is reachable from the given node.
+ * @param node The node to start from.
+ * @param uses The number of uses of each node, which is updated.
+ * @param visited A flag for each node which was already counted, which is updated.
+ */
+template <class T>
+void MatrixExprGraph<T>::_countUses(unsigned int node, std::vector<unsigned int>& uses,
+                                    std::vector<bool>& visited) const
+{
+    if (visited[node] || _nodes[node].operation == INPUT)
+    {
+        return;
+    }
+    visited[node] = true;
+
+    uses[_nodes[node].first]++;
+    _countUses(_nodes[node].first, uses, visited);
+    if (_nodes[node].operation != TRANSPOSE)
+    {
+        uses[_nodes[node].second]++;
+        _countUses(_nodes[node].second, uses, visited);
+    }
+}
+
+/**
+ * @brief Collect the factors of the chain of multiplications of the given node. A product
+ *        which is used more than once is kept as a single factor, so it is still shared.
+ * @param node The node of the chain.
+ * @param uses The number of uses of each node.
+ * @param factors The factors of the chain, in order, which are updated.
+ */
+template <class T>
+void MatrixExprGraph<T>::_collectFactors(unsigned int node, const std::vector<unsigned int>& uses,
+                                         std::vector<unsigned int>& factors) const
+{
+    for (unsigned int operand : {_nodes[node].first, _nodes[node].second})
+    {
+        if (_nodes[operand].operation == MULTIPLY && uses[operand] == SINGLE_USE)
+        {
+            _collectFactors(operand, uses, factors);
+        }
+        else
+        {
+            factors.push_back(operand);
+        }
+    }
+}
+
+/**
+ * @brief Returns the node of the product of the given factors, in the order which performs
+ *        the least scalar multiplications (by the classic matrix-chain dynamic programming).
+ * @param factors The factors of the chain, in order.
+ * @return The node of the product.
+ */
+template <class T>
+unsigned int MatrixExprGraph<T>::_orderChain(const std::vector<unsigned int>& factors)
+{
+    // The dimensions of factor i are dimensions[i] x dimensions[i + 1].
+    unsigned int count = (unsigned int) factors.size();
+    std::vector<double> dimensions;
+    for (unsigned int factor : factors)
+    {
+        dimensions.push_back(_nodes[factor].rows);
+    }
+    dimensions.push_back(_nodes[factors.back()].cols);
+
+    std::vector<std::vector<unsigned int>> split;
+    matrixChainOrder(dimensions, split);
+
+    // Build the products from the splits, shortest first, so every part is a node already.
+    std::vector<std::vector<unsigned int>> product(count, std::vector<unsigned int>(count, 0));
+    for (unsigned int i = 0; i < count; i++)
+    {
+        product[i][i] = factors[i];
+    }
+    for (unsigned int length = 2; length <= count; length++)
+    {
+        for (unsigned int i = 0; i + length <= count; i++)
+        {
+            unsigned int j = i + length - 1;
+            product[i][j] = _apply(MULTIPLY, product[i][split[i][j]],
+                                   product[split[i][j] + 1][j]);
+        }
+    }
+    return product[0][count - 1];
+}
+
+/**
+ * @brief Returns the node which computes the given node with all it's chains of
+ *        multiplications reordered.
+ * @param node The node to rewrite.
+ * @param uses The number of uses of each node.
+ * @param rewritten The rewritten node of each node which was already rewritten, which is
+ *        updated.
+ * @return The rewritten node.
+ */
+template <class T>
+unsigned int MatrixExprGraph<T>::_rewrite(unsigned int node, const std::vector<unsigned int>& uses,
+                                          std::map<unsigned int, unsigned int>& rewritten)
+{
+    std::map<unsigned int, unsigned int>::iterator existing = rewritten.find(node);
+    if (existing != rewritten.end())
+    {
+        return existing -> second;
+    }
+
+    // The node is copied, because new nodes may be added to the graph.
+    const _Node current = _nodes[node];
+    unsigned int result = node;
+    switch (current.operation)
+    {
+        case INPUT:
+            break;
+
+        case TRANSPOSE:
+            result = _apply(TRANSPOSE, _rewrite(current.first, uses, rewritten), NO_OPERAND);
+            break;
+
+        case MULTIPLY:
+        {
+            std::vector<unsigned int> factors;
+            _collectFactors(node, uses, factors);
+            for (unsigned int& factor : factors)
+            {
+                factor = _rewrite(factor, uses, rewritten);
+            }
+            result = _orderChain(factors);
+            break;
+        }
+
+        default:
+            result = _apply(current.operation, _rewrite(current.first, uses, rewritten),
+                            _rewrite(current.second, uses, rewritten));
+            break;
+    }
+
+    rewritten[node] = result;
+    return result;
+}
+
+/**
+ * @brief Returns the Future of the given node, scheduling it (and the nodes it depends on)
+ *        on the shared Matrix Thread Pool if it was not scheduled yet.
+ * @param node The node to schedule.
+ * @param futures The Future of each node which was already scheduled, which is updated.
+ * @return The Future of the node.
+ */
+template <class T>
+MatrixFuture<T> MatrixExprGraph<T>::_schedule(unsigned int node,
+                                              std::map<unsigned int, MatrixFuture<T>>& futures)
+                                              const
+{
+    typename std::map<unsigned int, MatrixFuture<T>>::iterator existing = futures.find(node);
+    if (existing != futures.end())
+    {
+        return existing -> second;
+    }
+
+    const _Node& current = _nodes[node];
+    if (current.operation == INPUT)
+    {
+        futures.insert(std::make_pair(node, _inputs[current.first]));
+        return _inputs[current.first];
+    }
+
+    MatrixFuture<T> first = _schedule(current.first, futures);
+    if (current.operation == TRANSPOSE)
+    {
+        MatrixFuture<T> result = Matrix<T>::transAsync(first);
+        futures.insert(std::make_pair(node, result));
+        return result;
+    }
+
+    MatrixFuture<T> second = _schedule(current.second, futures);
+    _Operation operation = current.operation;
+    std::function<Matrix<T>()> task = [operation, first, second]() -> Matrix<T>
+    {
+        switch (operation)
+        {
+            case ADD:
+                return first.get() + second.get();
+            case SUBTRACT:
+                return first.get() - second.get();
+            default:
+                return first.get() * second.get();
+        }
+    };
+    MatrixFuture<T> result = MatrixFuture<T>::after({first, second}, task);
+    futures.insert(std::make_pair(node, result));
+    return result;
+}
+
+#endif
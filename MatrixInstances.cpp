@@ -0,0 +1,38 @@
+/**
+ * @file MatrixInstances.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 18 Oct 2026
+ *
+ * @brief The Matrix Library, which compiles the Matrices of the standard element types.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * The Matrix Library, which compiles the Matrices of the standard element types.
+ * The Matrix is a Template Class, so every file which uses it compiles all of it's functions
+ * again. This file instantiates the Matrices of int, double and Complex once, and it's built
+ * into a static library (libmatrix.a) and a shared library (libmatrix.so). A program which
+ * links one of them and defines MATRIX_PRECOMPILED (e.g. -DMATRIX_PRECOMPILED) uses these
+ * instances instead of compiling them, while Matrices of other element types are still
+ * compiled from the headers.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include "Matrix.h"
+#include "Complex.h"
+
+
+/*-----=  Explicit Instantiations  =-----*/
+
+
+template class Matrix<int>;
+template class Matrix<double>;
+template class Matrix<Complex>;
+template class MatrixCache<int>;
+template class MatrixCache<double>;
+template class MatrixCache<Complex>;
@@ -0,0 +1,1203 @@
+/**
+ * @file MatrixKernels.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 18 Oct 2026
+ *
+ * @brief A Header File for the Matrix Kernels Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the Matrix Kernels Class.
+ * The Matrix Kernels are the element-type specific inner loops of the Matrix operations.
+ * The multiplication kernels compute a single row of the product. Each of them walks the rows
+ * of the second Matrix (so the memory is read sequentially) and accumulates into a wider type
+ * than the elements:
+ *      int - The products (which are exact) and sums are accumulated in 64 bits, and a result
+ *            which doesn't fit an int, or a sum which doesn't fit 64 bits, is reported as an
+ *            overflow. The sums of a row are checked only once the factors of the row are
+ *            large enough to overflow them (see UNCHECKED_FACTORS_LIMIT).
+ *      float - The products and sums of float operands are accumulated in double.
+ *      double - The products and sums are accumulated in double (e.g. for the real products of
+ *               the Complex multiplication).
+ * The addition and subtraction kernels combine two runs of cells into a third one (the Complex
+ * cells are combined as pairs of doubles).
+ * Each kernel is compiled in several variants of the x86 instruction set (a plain loop, AVX2
+ * and AVX-512), and the best variant which the processor supports is chosen once, on the first
+ * call of a kernel, so a single binary runs everywhere and uses the wide vectors where they
+ * exist. The environment variable MATRIX_KERNELS may limit the choice to "baseline" or "avx2"
+ * (e.g. to compare the variants). All the variants give the same results, since the products
+ * and the sums are rounded separately (without fused multiply-add) and in the same order.
+ * On other compilers and processors only the plain loop is compiled.
+ */
+
+
+#ifndef _MATRIXKERNELS_H
+#define _MATRIXKERNELS_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <climits>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include "Complex.h"
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define MATRIX_KERNEL_DISPATCH
+#include <immintrin.h>
+#endif
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def AVX2_LANES 4
+ * @brief A Macro that sets the number of 64 bits cells processed at once by the AVX2 kernels.
+ */
+#define AVX2_LANES 4
+
+/**
+ * @def AVX512_LANES 8
+ * @brief A Macro that sets the number of 64 bits cells processed at once by the AVX-512
+ *        kernels.
+ */
+#define AVX512_LANES 8
+
+/**
+ * @def KERNEL_VARIANT_VARIABLE "MATRIX_KERNELS"
+ * @brief A Macro that sets the name of the environment variable which limits the variant of
+ *        the kernels.
+ */
+#define KERNEL_VARIANT_VARIABLE "MATRIX_KERNELS"
+
+/**
+ * @def UNCHECKED_FACTORS_LIMIT 4294967295ULL
+ * @brief A Macro that sets the largest sum of the magnitudes of the factors (the cells of the
+ *        row of the first Matrix) of an int product, for which the sums surely fit 64 bits:
+ *        a cell of the second Matrix is at most 2^31 in magnitude, so the sums are below
+ *        (2^32 - 1) * 2^31 < 2^63. The sums of the following factors are checked one by one.
+ */
+#define UNCHECKED_FACTORS_LIMIT 4294967295ULL
+
+#ifdef MATRIX_KERNEL_DISPATCH
+
+/**
+ * @def AVX2_KERNEL
+ * @brief A Macro that compiles a function for processors with AVX2.
+ */
+#define AVX2_KERNEL __attribute__((target("avx2")))
+
+/**
+ * @def AVX512_KERNEL
+ * @brief A Macro that compiles a function for processors with AVX-512.
+ */
+#define AVX512_KERNEL __attribute__((target("avx512f")))
+
+#endif
+
+
+/*-----=  Enums  =-----*/
+
+
+/**
+ * @brief An Enum of the instruction set variants of the kernels, from the narrowest.
+ */
+enum MatrixKernelVariant
+{
+    BASELINE_KERNELS,
+    AVX2_KERNELS,
+    AVX512_KERNELS
+};
+
+
+/*-----=  Class Definition  =-----*/
+
+
+/**
+ * @brief A Class which groups the kernels of the Matrix operations.
+ *        All the Matrices are given as raw row-major cells.
+ */
+class MatrixKernels
+{
+public:
+
+    /**
+     * @brief Returns the variant of the kernels which is used by this process.
+     * @return The variant of the kernels.
+     */
+    static MatrixKernelVariant variant()
+    {
+        return _kernels().variant;
+    };
+
+    /**
+     * @brief Returns the name of the given variant of the kernels.
+     * @param variant The variant of the kernels.
+     * @return The name of the variant (e.g. "avx2").
+     */
+    static const char *variantName(MatrixKernelVariant variant);
+
+    /**
+     * @brief Compute a single row of the product of two int Matrices, using 64 bits wide
+     *        accumulators. A sum which doesn't fit 64 bits is detected (see
+     *        UNCHECKED_FACTORS_LIMIT), so it is reported as an overflow instead of wrapping.
+     * @param firstRow The row of the first Matrix (with 'inner' cells).
+     * @param second The cells of the second Matrix (with 'inner' rows and 'cols' columns).
+     * @param resultRow The row of the result Matrix (with 'cols' cells), or null to keep the
+     *        sums only in the accumulators (e.g. the partial sums of a slice).
+     * @param inner The number of columns in the first Matrix.
+     * @param cols The number of columns in the second Matrix.
+     * @param stride The distance between two consecutive rows of the second Matrix, so the
+     *        columns may be a part of wider rows.
+     * @param accumulators A buffer of 'cols' accumulators, which holds the sums.
+     * @return true if all the sums fit 64 bits (and the cells of the result row fit an int),
+     *         false if the row has overflowed.
+     */
+    static bool multiplyRow(const int *firstRow, const int *second, int *resultRow,
+                            unsigned int inner, unsigned int cols, unsigned int stride,
+                            long long *accumulators)
+    {
+        return _kernels().multiplyInts(firstRow, second, resultRow, inner, cols, stride,
+                                       accumulators);
+    };
+
+    /**
+     * @brief Add a run of 64 bits sums to another run of sums (e.g. the partial sums of the
+     *        slices of an int product).
+     * @param sums The run of sums to add to.
+     * @param terms The run of sums to add.
+     * @param count The number of sums in each run.
+     * @return true if all the sums fit 64 bits, false if one of them has overflowed.
+     */
+    static bool accumulate(long long *sums, const long long *terms, std::size_t count);
+
+    /**
+     * @brief Compute a single row of the product of two float Matrices into double cells, so
+     *        the products are exact and only the sums are rounded (in double).
+     * @param firstRow The row of the first Matrix (with 'inner' cells).
+     * @param second The cells of the second Matrix (with 'inner' rows and 'cols' columns).
+     * @param resultRow The row of the result Matrix (with 'cols' cells).
+     * @param inner The number of columns in the first Matrix.
+     * @param cols The number of columns in the second Matrix.
+     * @param stride The distance between two consecutive rows of the second Matrix, so the
+     *        columns may be a part of wider rows.
+     */
+    static void multiplyRow(const float *firstRow, const float *second, double *resultRow,
+                            unsigned int inner, unsigned int cols, unsigned int stride)
+    {
+        _kernels().multiplyFloats(firstRow, second, resultRow, inner, cols, stride);
+    };
+
+    /**
+     * @brief Compute a single row of the product of two double Matrices.
+     * @param firstRow The row of the first Matrix (with 'inner' cells).
+     * @param second The cells of the second Matrix (with 'inner' rows and 'cols' columns).
+     * @param resultRow The row of the result Matrix (with 'cols' cells).
+     * @param inner The number of columns in the first Matrix.
+     * @param cols The number of columns in the second Matrix.
+     * @param stride The distance between two consecutive rows of the second Matrix, so the
+     *        columns may be a part of wider rows.
+     */
+    static void multiplyRow(const double *firstRow, const double *second, double *resultRow,
+                            unsigned int inner, unsigned int cols, unsigned int stride)
+    {
+        _kernels().multiplyDoubles(firstRow, second, resultRow, inner, cols, stride);
+    };
+
+    /**
+     * @brief Add two runs of int cells (the sums wrap around like the vector instructions).
+     * @param first The first run of cells.
+     * @param second The second run of cells.
+     * @param result The run of the sums, which may be one of the other runs.
+     * @param count The number of cells in each run.
+     */
+    static void add(const int *first, const int *second, int *result, std::size_t count)
+    {
+        _kernels().addInts(first, second, result, count);
+    };
+
+    /**
+     * @brief Add two runs of double cells.
+     * @param first The first run of cells.
+     * @param second The second run of cells.
+     * @param result The run of the sums, which may be one of the other runs.
+     * @param count The number of cells in each run.
+     */
+    static void add(const double *first, const double *second, double *result,
+                    std::size_t count)
+    {
+        _kernels().addDoubles(first, second, result, count);
+    };
+
+    /**
+     * @brief Add two runs of Complex cells, as runs of twice as many doubles.
+     * @param first The first run of cells.
+     * @param second The second run of cells.
+     * @param result The run of the sums, which may be one of the other runs.
+     * @param count The number of cells in each run.
+     */
+    static void add(const Complex *first, const Complex *second, Complex *result,
+                    std::size_t count)
+    {
+        _kernels().addDoubles((const double *) first, (const double *) second,
+                              (double *) result, 2 * count);
+    };
+
+    /**
+     * @brief Add two runs of cells of any other type, with it's operator '+'.
+     * @param first The first run of cells.
+     * @param second The second run of cells.
+     * @param result The run of the sums, which may be one of the other runs.
+     * @param count The number of cells in each run.
+     */
+    template <class T>
+    static void add(const T *first, const T *second, T *result, std::size_t count)
+    {
+        _addCells(first, second, result, count);
+    };
+
+    /**
+     * @brief Subtract a run of int cells from another (the differences wrap around like the
+     *        vector instructions).
+     * @param first The run of cells to subtract from.
+     * @param second The run of cells to subtract.
+     * @param result The run of the differences, which may be one of the other runs.
+     * @param count The number of cells in each run.
+     */
+    static void subtract(const int *first, const int *second, int *result, std::size_t count)
+    {
+        _kernels().subtractInts(first, second, result, count);
+    };
+
+    /**
+     * @brief Subtract a run of double cells from another.
+     * @param first The run of cells to subtract from.
+     * @param second The run of cells to subtract.
+     * @param result The run of the differences, which may be one of the other runs.
+     * @param count The number of cells in each run.
+     */
+    static void subtract(const double *first, const double *second, double *result,
+                         std::size_t count)
+    {
+        _kernels().subtractDoubles(first, second, result, count);
+    };
+
+    /**
+     * @brief Subtract a run of Complex cells from another, as runs of twice as many doubles.
+     * @param first The run of cells to subtract from.
+     * @param second The run of cells to subtract.
+     * @param result The run of the differences, which may be one of the other runs.
+     * @param count The number of cells in each run.
+     */
+    static void subtract(const Complex *first, const Complex *second, Complex *result,
+                         std::size_t count)
+    {
+        _kernels().subtractDoubles((const double *) first, (const double *) second,
+                                   (double *) result, 2 * count);
+    };
+
+    /**
+     * @brief Subtract a run of cells of any other type from another, with it's operator '-='.
+     * @param first The run of cells to subtract from.
+     * @param second The run of cells to subtract.
+     * @param result The run of the differences, which may be one of the other runs.
+     * @param count The number of cells in each run.
+     */
+    template <class T>
+    static void subtract(const T *first, const T *second, T *result, std::size_t count)
+    {
+        _subtractCells(first, second, result, count);
+    };
+
+private:
+
+    /**
+     * @brief A Struct representing a variant of the kernels, as a table of it's functions.
+     */
+    struct Table
+    {
+        MatrixKernelVariant variant;
+        bool (*multiplyInts)(const int *, const int *, int *, unsigned int, unsigned int,
+                             unsigned int, long long *);
+        void (*multiplyFloats)(const float *, const float *, double *, unsigned int,
+                               unsigned int, unsigned int);
+        void (*multiplyDoubles)(const double *, const double *, double *, unsigned int,
+                                unsigned int, unsigned int);
+        void (*addInts)(const int *, const int *, int *, std::size_t);
+        void (*subtractInts)(const int *, const int *, int *, std::size_t);
+        void (*addDoubles)(const double *, const double *, double *, std::size_t);
+        void (*subtractDoubles)(const double *, const double *, double *, std::size_t);
+    };
+
+    /**
+     * @brief Returns the variant of the kernels which is used by this process. It's chosen on
+     *        the first call, and shared by all the threads.
+     * @return The table of the variant.
+     */
+    static const Table& _kernels()
+    {
+        static const Table table = _select();
+        return table;
+    };
+
+    /**
+     * @brief Choose the best variant of the kernels which the processor supports, up to the
+     *        limit in the environment variable.
+     * @return The table of the variant.
+     */
+    static Table _select();
+
+    /**
+     * @brief Add two runs of cells with their operator '+'.
+     */
+    template <class T>
+    static void _addCells(const T *first, const T *second, T *result, std::size_t count);
+
+    /**
+     * @brief Subtract a run of cells from another with their operator '-='.
+     */
+    template <class T>
+    static void _subtractCells(const T *first, const T *second, T *result, std::size_t count);
+
+    /**
+     * @brief The plain variant of the addition or subtraction of int cells.
+     */
+    template <bool Subtract>
+    static void _combineInts(const int *first, const int *second, int *result,
+                             std::size_t count);
+
+    /**
+     * @brief The plain variant of multiplyRow for int Matrices.
+     */
+    static bool _multiplyInts(const int *firstRow, const int *second, int *resultRow,
+                              unsigned int inner, unsigned int cols, unsigned int stride,
+                              long long *accumulators);
+
+    /**
+     * @brief The plain variant of multiplyRow for float Matrices.
+     */
+    static void _multiplyFloats(const float *firstRow, const float *second, double *resultRow,
+                                unsigned int inner, unsigned int cols, unsigned int stride);
+
+    /**
+     * @brief The plain variant of multiplyRow for double Matrices.
+     */
+    static void _multiplyDoubles(const double *firstRow, const double *second,
+                                 double *resultRow, unsigned int inner, unsigned int cols,
+                                 unsigned int stride);
+
+    /**
+     * @brief Add the given row of the second Matrix of an int product, scaled by the given
+     *        factor, to the given accumulators, checking each sum for an overflow of 64 bits.
+     * @param factor The factor.
+     * @param secondRow The row of the second Matrix.
+     * @param accumulators The accumulators.
+     * @param cols The number of accumulators.
+     * @return true if all the sums fit 64 bits, false otherwise.
+     */
+    static bool _accumulateChecked(long long factor, const int *secondRow,
+                                   long long *accumulators, unsigned int cols);
+
+    /**
+     * @brief Returns true if all the given accumulators fit an int, and copy them into the
+     *        given row.
+     * @param accumulators The accumulators.
+     * @param resultRow The row of the result Matrix, or null to leave the accumulators.
+     * @param cols The number of accumulators.
+     * @return true if all the accumulators fit an int, false otherwise.
+     */
+    static bool _narrow(const long long *accumulators, int *resultRow, unsigned int cols);
+
+#ifdef MATRIX_KERNEL_DISPATCH
+
+    /**
+     * @brief The AVX2 variant of multiplyRow for int Matrices.
+     */
+    AVX2_KERNEL static bool _multiplyIntsAvx2(const int *firstRow, const int *second,
+                                              int *resultRow, unsigned int inner,
+                                              unsigned int cols, unsigned int stride,
+                                              long long *accumulators);
+
+    /**
+     * @brief The AVX2 variant of multiplyRow for float Matrices.
+     */
+    AVX2_KERNEL static void _multiplyFloatsAvx2(const float *firstRow, const float *second,
+                                                double *resultRow, unsigned int inner,
+                                                unsigned int cols, unsigned int stride);
+
+    /**
+     * @brief The AVX2 variant of multiplyRow for double Matrices.
+     */
+    AVX2_KERNEL static void _multiplyDoublesAvx2(const double *firstRow, const double *second,
+                                                 double *resultRow, unsigned int inner,
+                                                 unsigned int cols, unsigned int stride);
+
+    /**
+     * @brief The AVX2 variant of the addition or subtraction of int cells.
+     */
+    template <bool Subtract>
+    AVX2_KERNEL static void _combineIntsAvx2(const int *first, const int *second, int *result,
+                                             std::size_t count);
+
+    /**
+     * @brief The AVX2 variant of the addition or subtraction of double cells.
+     */
+    template <bool Subtract>
+    AVX2_KERNEL static void _combineDoublesAvx2(const double *first, const double *second,
+                                                double *result, std::size_t count);
+
+    /**
+     * @brief The AVX-512 variant of multiplyRow for int Matrices.
+     */
+    AVX512_KERNEL static bool _multiplyIntsAvx512(const int *firstRow, const int *second,
+                                                  int *resultRow, unsigned int inner,
+                                                  unsigned int cols, unsigned int stride,
+                                                  long long *accumulators);
+
+    /**
+     * @brief The AVX-512 variant of multiplyRow for float Matrices.
+     */
+    AVX512_KERNEL static void _multiplyFloatsAvx512(const float *firstRow, const float *second,
+                                                    double *resultRow, unsigned int inner,
+                                                    unsigned int cols, unsigned int stride);
+
+    /**
+     * @brief The AVX-512 variant of multiplyRow for double Matrices.
+     */
+    AVX512_KERNEL static void _multiplyDoublesAvx512(const double *firstRow,
+                                                     const double *second, double *resultRow,
+                                                     unsigned int inner, unsigned int cols,
+                                                     unsigned int stride);
+
+    /**
+     * @brief The AVX-512 variant of the addition or subtraction of int cells.
+     */
+    template <bool Subtract>
+    AVX512_KERNEL static void _combineIntsAvx512(const int *first, const int *second,
+                                                 int *result, std::size_t count);
+
+    /**
+     * @brief The AVX-512 variant of the addition or subtraction of double cells.
+     */
+    template <bool Subtract>
+    AVX512_KERNEL static void _combineDoublesAvx512(const double *first, const double *second,
+                                                    double *result, std::size_t count);
+
+#endif
+};
+
+
+/*-----=  Dispatch  =-----*/
+
+
+/**
+ * @brief Returns the name of the given variant of the kernels.
+ * @param variant The variant of the kernels.
+ * @return The name of the variant (e.g. "avx2").
+ */
+inline const char *MatrixKernels::variantName(MatrixKernelVariant variant)
+{
+    switch (variant)
+    {
+        case AVX512_KERNELS:
+            return "avx512";
+        case AVX2_KERNELS:
+            return "avx2";
+        default:
+            return "baseline";
+    }
+}
+
+/**
+ * @brief Choose the best variant of the kernels which the processor supports, up to the limit
+ *        in the environment variable.
+ * @return The table of the variant.
+ */
+inline MatrixKernels::Table MatrixKernels::_select()
+{
+    Table table = {BASELINE_KERNELS, &_multiplyInts, &_multiplyFloats, &_multiplyDoubles,
+                   &_combineInts<false>, &_combineInts<true>, &_addCells<double>,
+                   &_subtractCells<double>};
+#ifdef MATRIX_KERNEL_DISPATCH
+    MatrixKernelVariant limit = AVX512_KERNELS;
+    const char *setting = std::getenv(KERNEL_VARIANT_VARIABLE);
+    if (setting != nullptr)
+    {
+        for (int variant = BASELINE_KERNELS; variant <= AVX512_KERNELS; variant++)
+        {
+            if (std::strcmp(setting, variantName((MatrixKernelVariant) variant)) == 0)
+            {
+                limit = (MatrixKernelVariant) variant;
+            }
+        }
+    }
+
+    __builtin_cpu_init();
+    if (limit >= AVX512_KERNELS && __builtin_cpu_supports("avx512f"))
+    {
+        table = {AVX512_KERNELS, &_multiplyIntsAvx512, &_multiplyFloatsAvx512,
+                 &_multiplyDoublesAvx512, &_combineIntsAvx512<false>, &_combineIntsAvx512<true>,
+                 &_combineDoublesAvx512<false>, &_combineDoublesAvx512<true>};
+    }
+    else if (limit >= AVX2_KERNELS && __builtin_cpu_supports("avx2"))
+    {
+        table = {AVX2_KERNELS, &_multiplyIntsAvx2, &_multiplyFloatsAvx2, &_multiplyDoublesAvx2,
+                 &_combineIntsAvx2<false>, &_combineIntsAvx2<true>,
+                 &_combineDoublesAvx2<false>, &_combineDoublesAvx2<true>};
+    }
+#endif
+    return table;
+}
+
+
+/*-----=  Baseline Kernels  =-----*/
+
+
+/**
+ * @brief Add a run of 64 bits sums to another run of sums. The sums are computed in unsigned
+ *        arithmetic (so they wrap around instead of being undefined), and a sum has
+ *        overflowed if it's sign differs from the signs of both of it's terms.
+ * @param sums The run of sums to add to.
+ * @param terms The run of sums to add.
+ * @param count The number of sums in each run.
+ * @return true if all the sums fit 64 bits, false if one of them has overflowed.
+ */
+inline bool MatrixKernels::accumulate(long long *sums, const long long *terms, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; i++)
+    {
+        const unsigned long long first = (unsigned long long) sums[i];
+        const unsigned long long second = (unsigned long long) terms[i];
+        const unsigned long long sum = first + second;
+        if (((first ^ sum) & (second ^ sum)) >> 63)
+        {
+            return false;
+        }
+        sums[i] = (long long) sum;
+    }
+    return true;
+}
+
+/**
+ * @brief Add two runs of cells with their operator '+'.
+ * @param first The first run of cells.
+ * @param second The second run of cells.
+ * @param result The run of the sums.
+ * @param count The number of cells in each run.
+ */
+template <class T>
+inline void MatrixKernels::_addCells(const T *first, const T *second, T *result,
+                                     std::size_t count)
+{
+    for (std::size_t i = 0; i < count; i++)
+    {
+        result[i] = first[i] + second[i];
+    }
+}
+
+/**
+ * @brief Subtract a run of cells from another with their operator '-='.
+ * @param first The run of cells to subtract from.
+ * @param second The run of cells to subtract.
+ * @param result The run of the differences.
+ * @param count The number of cells in each run.
+ */
+template <class T>
+inline void MatrixKernels::_subtractCells(const T *first, const T *second, T *result,
+                                          std::size_t count)
+{
+    for (std::size_t i = 0; i < count; i++)
+    {
+        T difference(first[i]);
+        difference -= second[i];
+        result[i] = difference;
+    }
+}
+
+/**
+ * @brief Add or subtract two runs of int cells with a plain loop (in unsigned arithmetic, so
+ *        the results wrap around like the vector instructions).
+ * @param first The first run of cells.
+ * @param second The second run of cells.
+ * @param result The run of the results.
+ * @param count The number of cells in each run.
+ */
+template <bool Subtract>
+inline void MatrixKernels::_combineInts(const int *first, const int *second, int *result,
+                                        std::size_t count)
+{
+    for (std::size_t i = 0; i < count; i++)
+    {
+        result[i] = (int) (Subtract ? (unsigned int) first[i] - (unsigned int) second[i]
+                                    : (unsigned int) first[i] + (unsigned int) second[i]);
+    }
+}
+
+/**
+ * @brief Compute a single row of the product of two int Matrices with a plain loop.
+ * @param firstRow The row of the first Matrix (with 'inner' cells).
+ * @param second The cells of the second Matrix (with 'inner' rows and 'cols' columns).
+ * @param resultRow The row of the result Matrix (with 'cols' cells), or null to keep the sums
+ *        only in the accumulators.
+ * @param inner The number of columns in the first Matrix.
+ * @param cols The number of columns in the second Matrix.
+ * @param stride The distance between two consecutive rows of the second Matrix.
+ * @param accumulators A buffer of 'cols' accumulators.
+ * @return true if all the sums fit 64 bits (and the cells of the row fit an int), false if
+ *         the row has overflowed.
+ */
+inline bool MatrixKernels::_multiplyInts(const int *firstRow, const int *second, int *resultRow,
+                                         unsigned int inner, unsigned int cols,
+                                         unsigned int stride, long long *accumulators)
+{
+    for (unsigned int j = 0; j < cols; j++)
+    {
+        accumulators[j] = 0;
+    }
+
+    unsigned long long magnitude = 0;
+    for (unsigned int k = 0; k < inner; k++)
+    {
+        long long factor = firstRow[k];
+        if (factor == 0)
+        {
+            continue;
+        }
+        const int *secondRow = second + ((unsigned long) k * stride);
+        magnitude += (factor < 0) ? -factor : factor;
+        if (magnitude > UNCHECKED_FACTORS_LIMIT)
+        {
+            if (!_accumulateChecked(factor, secondRow, accumulators, cols))
+            {
+                return false;
+            }
+            continue;
+        }
+        for (unsigned int j = 0; j < cols; j++)
+        {
+            accumulators[j] += factor * secondRow[j];
+        }
+    }
+    return _narrow(accumulators, resultRow, cols);
+}
+
+/**
+ * @brief Compute a single row of the product of two float Matrices into double cells with a
+ *        plain loop.
+ * @param firstRow The row of the first Matrix (with 'inner' cells).
+ * @param second The cells of the second Matrix (with 'inner' rows and 'cols' columns).
+ * @param resultRow The row of the result Matrix (with 'cols' cells).
+ * @param inner The number of columns in the first Matrix.
+ * @param cols The number of columns in the second Matrix.
+ * @param stride The distance between two consecutive rows of the second Matrix.
+ */
+inline void MatrixKernels::_multiplyFloats(const float *firstRow, const float *second,
+                                           double *resultRow, unsigned int inner,
+                                           unsigned int cols, unsigned int stride)
+{
+    for (unsigned int j = 0; j < cols; j++)
+    {
+        resultRow[j] = 0;
+    }
+
+    for (unsigned int k = 0; k < inner; k++)
+    {
+        double factor = firstRow[k];
+        const float *secondRow = second + ((unsigned long) k * stride);
+        for (unsigned int j = 0; j < cols; j++)
+        {
+            resultRow[j] += factor * secondRow[j];
+        }
+    }
+}
+
+/**
+ * @brief Compute a single row of the product of two double Matrices with a plain loop.
+ * @param firstRow The row of the first Matrix (with 'inner' cells).
+ * @param second The cells of the second Matrix (with 'inner' rows and 'cols' columns).
+ * @param resultRow The row of the result Matrix (with 'cols' cells).
+ * @param inner The number of columns in the first Matrix.
+ * @param cols The number of columns in the second Matrix.
+ * @param stride The distance between two consecutive rows of the second Matrix.
+ */
+inline void MatrixKernels::_multiplyDoubles(const double *firstRow, const double *second,
+                                            double *resultRow, unsigned int inner,
+                                            unsigned int cols, unsigned int stride)
+{
+    for (unsigned int j = 0; j < cols; j++)
+    {
+        resultRow[j] = 0;
+    }
+
+    for (unsigned int k = 0; k < inner; k++)
+    {
+        double factor = firstRow[k];
+        const double *secondRow = second + ((unsigned long) k * stride);
+        for (unsigned int j = 0; j < cols; j++)
+        {
+            resultRow[j] += factor * secondRow[j];
+        }
+    }
+}
+
+/**
+ * @brief Add the given row of the second Matrix of an int product, scaled by the given factor,
+ *        to the given accumulators, checking each sum for an overflow of 64 bits.
+ * @param factor The factor.
+ * @param secondRow The row of the second Matrix.
+ * @param accumulators The accumulators.
+ * @param cols The number of accumulators.
+ * @return true if all the sums fit 64 bits, false otherwise.
+ */
+inline bool MatrixKernels::_accumulateChecked(long long factor, const int *secondRow,
+                                              long long *accumulators, unsigned int cols)
+{
+    for (unsigned int j = 0; j < cols; j++)
+    {
+        // The product of two int cells always fits 64 bits.
+        const long long term = factor * secondRow[j];
+        if (!accumulate(accumulators + j, &term, 1))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Returns true if all the given accumulators fit an int, and copy them into the given
+ *        row.
+ * @param accumulators The accumulators.
+ * @param resultRow The row of the result Matrix, or null to leave the accumulators.
+ * @param cols The number of accumulators.
+ * @return true if all the accumulators fit an int, false otherwise.
+ */
+inline bool MatrixKernels::_narrow(const long long *accumulators, int *resultRow,
+                                   unsigned int cols)
+{
+    if (resultRow == nullptr)
+    {
+        return true;
+    }
+    bool fits = true;
+    for (unsigned int j = 0; j < cols; j++)
+    {
+        fits = fits && (accumulators[j] >= INT_MIN) && (accumulators[j] <= INT_MAX);
+        resultRow[j] = (int) accumulators[j];
+    }
+    return fits;
+}
+
+
+#ifdef MATRIX_KERNEL_DISPATCH
+
+/*-----=  AVX2 Kernels  =-----*/
+
+
+/**
+ * @brief Compute a single row of the product of two int Matrices, four columns at once.
+ *        Each lane sign-extends a cell to 64 bits, so the 32 x 32 bits products are exact.
+ * @param firstRow The row of the first Matrix (with 'inner' cells).
+ * @param second The cells of the second Matrix (with 'inner' rows and 'cols' columns).
+ * @param resultRow The row of the result Matrix (with 'cols' cells), or null to keep the sums
+ *        only in the accumulators.
+ * @param inner The number of columns in the first Matrix.
+ * @param cols The number of columns in the second Matrix.
+ * @param stride The distance between two consecutive rows of the second Matrix.
+ * @param accumulators A buffer of 'cols' accumulators.
+ * @return true if all the sums fit 64 bits (and the cells of the row fit an int), false if
+ *         the row has overflowed.
+ */
+AVX2_KERNEL inline bool MatrixKernels::_multiplyIntsAvx2(const int *firstRow, const int *second,
+                                                         int *resultRow, unsigned int inner,
+                                                         unsigned int cols, unsigned int stride,
+                                                         long long *accumulators)
+{
+    for (unsigned int j = 0; j < cols; j++)
+    {
+        accumulators[j] = 0;
+    }
+
+    unsigned long long magnitude = 0;
+    for (unsigned int k = 0; k < inner; k++)
+    {
+        long long factor = firstRow[k];
+        if (factor == 0)
+        {
+            continue;
+        }
+        const int *secondRow = second + ((unsigned long) k * stride);
+        magnitude += (factor < 0) ? -factor : factor;
+        if (magnitude > UNCHECKED_FACTORS_LIMIT)
+        {
+            if (!_accumulateChecked(factor, secondRow, accumulators, cols))
+            {
+                return false;
+            }
+            continue;
+        }
+        const __m256i factors = _mm256_set1_epi64x(factor);
+        unsigned int j = 0;
+        for (; j + AVX2_LANES <= cols; j += AVX2_LANES)
+        {
+            __m256i cells = _mm256_cvtepi32_epi64(
+                    _mm_loadu_si128((const __m128i *) (secondRow + j)));
+            __m256i *lanes = (__m256i *) (accumulators + j);
+            _mm256_storeu_si256(lanes, _mm256_add_epi64(_mm256_loadu_si256(lanes),
+                                                         _mm256_mul_epi32(factors, cells)));
+        }
+        for (; j < cols; j++)
+        {
+            accumulators[j] += factor * secondRow[j];
+        }
+    }
+    return _narrow(accumulators, resultRow, cols);
+}
+
+/**
+ * @brief Compute a single row of the product of two float Matrices into double cells, four
+ *        columns at once.
+ * @param firstRow The row of the first Matrix (with 'inner' cells).
+ * @param second The cells of the second Matrix (with 'inner' rows and 'cols' columns).
+ * @param resultRow The row of the result Matrix (with 'cols' cells).
+ * @param inner The number of columns in the first Matrix.
+ * @param cols The number of columns in the second Matrix.
+ * @param stride The distance between two consecutive rows of the second Matrix.
+ */
+AVX2_KERNEL inline void MatrixKernels::_multiplyFloatsAvx2(const float *firstRow,
+                                                           const float *second,
+                                                           double *resultRow, unsigned int inner,
+                                                           unsigned int cols,
+                                                           unsigned int stride)
+{
+    for (unsigned int j = 0; j < cols; j++)
+    {
+        resultRow[j] = 0;
+    }
+
+    for (unsigned int k = 0; k < inner; k++)
+    {
+        double factor = firstRow[k];
+        const float *secondRow = second + ((unsigned long) k * stride);
+        const __m256d factors = _mm256_set1_pd(factor);
+        unsigned int j = 0;
+        for (; j + AVX2_LANES <= cols; j += AVX2_LANES)
+        {
+            __m256d cells = _mm256_cvtps_pd(_mm_loadu_ps(secondRow + j));
+            _mm256_storeu_pd(resultRow + j, _mm256_add_pd(_mm256_loadu_pd(resultRow + j),
+                                                          _mm256_mul_pd(factors, cells)));
+        }
+        for (; j < cols; j++)
+        {
+            resultRow[j] += factor * secondRow[j];
+        }
+    }
+}
+
+/**
+ * @brief Compute a single row of the product of two double Matrices, four columns at once.
+ * @param firstRow The row of the first Matrix (with 'inner' cells).
+ * @param second The cells of the second Matrix (with 'inner' rows and 'cols' columns).
+ * @param resultRow The row of the result Matrix (with 'cols' cells).
+ * @param inner The number of columns in the first Matrix.
+ * @param cols The number of columns in the second Matrix.
+ * @param stride The distance between two consecutive rows of the second Matrix.
+ */
+AVX2_KERNEL inline void MatrixKernels::_multiplyDoublesAvx2(const double *firstRow,
+                                                            const double *second,
+                                                            double *resultRow,
+                                                            unsigned int inner,
+                                                            unsigned int cols,
+                                                            unsigned int stride)
+{
+    for (unsigned int j = 0; j < cols; j++)
+    {
+        resultRow[j] = 0;
+    }
+
+    for (unsigned int k = 0; k < inner; k++)
+    {
+        double factor = firstRow[k];
+        const double *secondRow = second + ((unsigned long) k * stride);
+        const __m256d factors = _mm256_set1_pd(factor);
+        unsigned int j = 0;
+        for (; j + AVX2_LANES <= cols; j += AVX2_LANES)
+        {
+            __m256d cells = _mm256_loadu_pd(secondRow + j);
+            _mm256_storeu_pd(resultRow + j, _mm256_add_pd(_mm256_loadu_pd(resultRow + j),
+                                                          _mm256_mul_pd(factors, cells)));
+        }
+        for (; j < cols; j++)
+        {
+            resultRow[j] += factor * secondRow[j];
+        }
+    }
+}
+
+/**
+ * @brief Add or subtract two runs of int cells, eight cells at once.
+ * @param first The first run of cells.
+ * @param second The second run of cells.
+ * @param result The run of the results.
+ * @param count The number of cells in each run.
+ */
+template <bool Subtract>
+AVX2_KERNEL inline void MatrixKernels::_combineIntsAvx2(const int *first, const int *second,
+                                                        int *result, std::size_t count)
+{
+    std::size_t i = 0;
+    for (; i + (2 * AVX2_LANES) <= count; i += 2 * AVX2_LANES)
+    {
+        __m256i left = _mm256_loadu_si256((const __m256i *) (first + i));
+        __m256i right = _mm256_loadu_si256((const __m256i *) (second + i));
+        _mm256_storeu_si256((__m256i *) (result + i), Subtract ? _mm256_sub_epi32(left, right)
+                                                               : _mm256_add_epi32(left, right));
+    }
+    for (; i < count; i++)
+    {
+        result[i] = (int) (Subtract ? (unsigned int) first[i] - (unsigned int) second[i]
+                                    : (unsigned int) first[i] + (unsigned int) second[i]);
+    }
+}
+
+/**
+ * @brief Add or subtract two runs of double cells, four cells at once.
+ * @param first The first run of cells.
+ * @param second The second run of cells.
+ * @param result The run of the results.
+ * @param count The number of cells in each run.
+ */
+template <bool Subtract>
+AVX2_KERNEL inline void MatrixKernels::_combineDoublesAvx2(const double *first,
+                                                           const double *second, double *result,
+                                                           std::size_t count)
+{
+    std::size_t i = 0;
+    for (; i + AVX2_LANES <= count; i += AVX2_LANES)
+    {
+        __m256d left = _mm256_loadu_pd(first + i);
+        __m256d right = _mm256_loadu_pd(second + i);
+        _mm256_storeu_pd(result + i, Subtract ? _mm256_sub_pd(left, right)
+                                              : _mm256_add_pd(left, right));
+    }
+    for (; i < count; i++)
+    {
+        result[i] = Subtract ? first[i] - second[i] : first[i] + second[i];
+    }
+}
+
+
+/*-----=  AVX-512 Kernels  =-----*/
+
+
+// The conversions of the AVX-512 headers of GCC start from undefined vectors, which it
+// reports as uninitialized when they are inlined with optimizations.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+/**
+ * @brief Compute a single row of the product of two int Matrices, eight columns at once.
+ *        Each lane sign-extends a cell to 64 bits, so the 32 x 32 bits products are exact.
+ * @param firstRow The row of the first Matrix (with 'inner' cells).
+ * @param second The cells of the second Matrix (with 'inner' rows and 'cols' columns).
+ * @param resultRow The row of the result Matrix (with 'cols' cells), or null to keep the sums
+ *        only in the accumulators.
+ * @param inner The number of columns in the first Matrix.
+ * @param cols The number of columns in the second Matrix.
+ * @param stride The distance between two consecutive rows of the second Matrix.
+ * @param accumulators A buffer of 'cols' accumulators.
+ * @return true if all the sums fit 64 bits (and the cells of the row fit an int), false if
+ *         the row has overflowed.
+ */
+AVX512_KERNEL inline bool MatrixKernels::_multiplyIntsAvx512(const int *firstRow,
+                                                             const int *second, int *resultRow,
+                                                             unsigned int inner,
+                                                             unsigned int cols,
+                                                             unsigned int stride,
+                                                             long long *accumulators)
+{
+    for (unsigned int j = 0; j < cols; j++)
+    {
+        accumulators[j] = 0;
+    }
+
+    unsigned long long magnitude = 0;
+    for (unsigned int k = 0; k < inner; k++)
+    {
+        long long factor = firstRow[k];
+        if (factor == 0)
+        {
+            continue;
+        }
+        const int *secondRow = second + ((unsigned long) k * stride);
+        magnitude += (factor < 0) ? -factor : factor;
+        if (magnitude > UNCHECKED_FACTORS_LIMIT)
+        {
+            if (!_accumulateChecked(factor, secondRow, accumulators, cols))
+            {
+                return false;
+            }
+            continue;
+        }
+        const __m512i factors = _mm512_set1_epi64(factor);
+        unsigned int j = 0;
+        for (; j + AVX512_LANES <= cols; j += AVX512_LANES)
+        {
+            __m512i cells = _mm512_cvtepi32_epi64(
+                    _mm256_loadu_si256((const __m256i *) (secondRow + j)));
+            _mm512_storeu_si512(accumulators + j,
+                                _mm512_add_epi64(_mm512_loadu_si512(accumulators + j),
+                                                 _mm512_mul_epi32(factors, cells)));
+        }
+        for (; j < cols; j++)
+        {
+            accumulators[j] += factor * secondRow[j];
+        }
+    }
+    return _narrow(accumulators, resultRow, cols);
+}
+
+/**
+ * @brief Compute a single row of the product of two float Matrices into double cells, eight
+ *        columns at once.
+ * @param firstRow The row of the first Matrix (with 'inner' cells).
+ * @param second The cells of the second Matrix (with 'inner' rows and 'cols' columns).
+ * @param resultRow The row of the result Matrix (with 'cols' cells).
+ * @param inner The number of columns in the first Matrix.
+ * @param cols The number of columns in the second Matrix.
+ * @param stride The distance between two consecutive rows of the second Matrix.
+ */
+AVX512_KERNEL inline void MatrixKernels::_multiplyFloatsAvx512(const float *firstRow,
+                                                               const float *second,
+                                                               double *resultRow,
+                                                               unsigned int inner,
+                                                               unsigned int cols,
+                                                               unsigned int stride)
+{
+    for (unsigned int j = 0; j < cols; j++)
+    {
+        resultRow[j] = 0;
+    }
+
+    for (unsigned int k = 0; k < inner; k++)
+    {
+        double factor = firstRow[k];
+        const float *secondRow = second + ((unsigned long) k * stride);
+        const __m512d factors = _mm512_set1_pd(factor);
+        unsigned int j = 0;
+        for (; j + AVX512_LANES <= cols; j += AVX512_LANES)
+        {
+            __m512d cells = _mm512_cvtps_pd(_mm256_loadu_ps(secondRow + j));
+            _mm512_storeu_pd(resultRow + j, _mm512_add_pd(_mm512_loadu_pd(resultRow + j),
+                                                          _mm512_mul_pd(factors, cells)));
+        }
+        for (; j < cols; j++)
+        {
+            resultRow[j] += factor * secondRow[j];
+        }
+    }
+}
+
+/**
+ * @brief Compute a single row of the product of two double Matrices, eight columns at once.
+ * @param firstRow The row of the first Matrix (with 'inner' cells).
+ * @param second The cells of the second Matrix (with 'inner' rows and 'cols' columns).
+ * @param resultRow The row of the result Matrix (with 'cols' cells).
+ * @param inner The number of columns in the first Matrix.
+ * @param cols The number of columns in the second Matrix.
+ * @param stride The distance between two consecutive rows of the second Matrix.
+ */
+AVX512_KERNEL inline void MatrixKernels::_multiplyDoublesAvx512(const double *firstRow,
+                                                                const double *second,
+                                                                double *resultRow,
+                                                                unsigned int inner,
+                                                                unsigned int cols,
+                                                                unsigned int stride)
+{
+    for (unsigned int j = 0; j < cols; j++)
+    {
+        resultRow[j] = 0;
+    }
+
+    for (unsigned int k = 0; k < inner; k++)
+    {
+        double factor = firstRow[k];
+        const double *secondRow = second + ((unsigned long) k * stride);
+        const __m512d factors = _mm512_set1_pd(factor);
+        unsigned int j = 0;
+        for (; j + AVX512_LANES <= cols; j += AVX512_LANES)
+        {
+            __m512d cells = _mm512_loadu_pd(secondRow + j);
+            _mm512_storeu_pd(resultRow + j, _mm512_add_pd(_mm512_loadu_pd(resultRow + j),
+                                                          _mm512_mul_pd(factors, cells)));
+        }
+        for (; j < cols; j++)
+        {
+            resultRow[j] += factor * secondRow[j];
+        }
+    }
+}
+
+/**
+ * @brief Add or subtract two runs of int cells, sixteen cells at once.
+ * @param first The first run of cells.
+ * @param second The second run of cells.
+ * @param result The run of the results.
+ * @param count The number of cells in each run.
+ */
+template <bool Subtract>
+AVX512_KERNEL inline void MatrixKernels::_combineIntsAvx512(const int *first, const int *second,
+                                                            int *result, std::size_t count)
+{
+    std::size_t i = 0;
+    for (; i + (2 * AVX512_LANES) <= count; i += 2 * AVX512_LANES)
+    {
+        __m512i left = _mm512_loadu_si512(first + i);
+        __m512i right = _mm512_loadu_si512(second + i);
+        _mm512_storeu_si512(result + i, Subtract ? _mm512_sub_epi32(left, right)
+                                                 : _mm512_add_epi32(left, right));
+    }
+    for (; i < count; i++)
+    {
+        result[i] = (int) (Subtract ? (unsigned int) first[i] - (unsigned int) second[i]
+                                    : (unsigned int) first[i] + (unsigned int) second[i]);
+    }
+}
+
+/**
+ * @brief Add or subtract two runs of double cells, eight cells at once.
+ * @param first The first run of cells.
+ * @param second The second run of cells.
+ * @param result The run of the results.
+ * @param count The number of cells in each run.
+ */
+template <bool Subtract>
+AVX512_KERNEL inline void MatrixKernels::_combineDoublesAvx512(const double *first,
+                                                               const double *second,
+                                                               double *result,
+                                                               std::size_t count)
+{
+    std::size_t i = 0;
+    for (; i + AVX512_LANES <= count; i += AVX512_LANES)
+    {
+        __m512d left = _mm512_loadu_pd(first + i);
+        __m512d right = _mm512_loadu_pd(second + i);
+        _mm512_storeu_pd(result + i, Subtract ? _mm512_sub_pd(left, right)
+                                              : _mm512_add_pd(left, right));
+    }
+    for (; i < count; i++)
+    {
+        result[i] = Subtract ? first[i] - second[i] : first[i] + second[i];
+    }
+}
+
+#pragma GCC diagnostic pop
+
+#endif
+
+#endif
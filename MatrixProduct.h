@@ -0,0 +1,141 @@
+/**
+ * @file MatrixProduct.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 18 Oct 2026
+ *
+ * @brief A Header File for the Matrix Product Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the Matrix Product Class.
+ * The Matrix Product maintains the product of two Matrices while their cells change. It tracks
+ * the changes of both Matrices, and on an update it recomputes only what the changes affect:
+ * the changed rows of the first Matrix (or the changed columns of the second Matrix) are
+ * multiplied again, and the changed columns of the first Matrix (or the changed rows of the
+ * second Matrix) are applied as a rank-k correction. So after k rows or columns change, an
+ * update of a product of n x n Matrices takes O(k * n^2) instead of O(n^3).
+ * Like the Matrix Class, this .h file includes it's .hpp file because this is a Template Class.
+ */
+
+
+#ifndef _MATRIXPRODUCT_H
+#define _MATRIXPRODUCT_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <vector>
+#include "Matrix.h"
+
+
+/*-----=  Class Definition  =-----*/
+
+
+/**
+ * @brief A Class representing the product of two Matrices which is kept up to date while the
+ *        Matrices change. The Matrices must outlive the product, and their changes must be
+ *        tracked while the product exists (the product turns the tracking on), so a Matrix
+ *        may be a part of a single Matrix Product at a time.
+ */
+template <class T>
+class MatrixProduct
+{
+public:
+
+    /**
+     * @brief A Constructor for the product of the given Matrices, which turns on the tracking
+     *        of their changes and computes their product.
+     *        If the dimensions of the Matrices doesn't fit, an Exception will be thrown.
+     * @param first The first Matrix in the product (on the left side).
+     * @param second The second Matrix in the product (on the right side).
+     */
+    MatrixProduct(Matrix<T>& first, Matrix<T>& second);
+
+    /**
+     * @brief Returns the product, as of the last update.
+     * @return The product.
+     */
+    const Matrix<T>& result() const { return _result; };
+
+    /**
+     * @brief Bring the product up to date with the changes of the Matrices since the last
+     *        update, and clear their changes. If the changes are too many for an incremental
+     *        update to be cheaper, the product is recomputed.
+     *        For floating point elements, the rank-k corrections round differently than a
+     *        full recomputation, so the cells may differ from it within the rounding errors.
+     *        For int elements the corrections are not checked for an overflow.
+     *        If the dimensions of the Matrices doesn't fit anymore, an Exception will be thrown.
+     * @return The updated product.
+     */
+    const Matrix<T>& update();
+
+private:
+
+    /**
+     * @brief The first Matrix in the product (on the left side).
+     */
+    Matrix<T>& _first;
+
+    /**
+     * @brief The second Matrix in the product (on the right side).
+     */
+    Matrix<T>& _second;
+
+    /**
+     * @brief A copy of the first Matrix as of the last update.
+     */
+    Matrix<T> _firstSnapshot;
+
+    /**
+     * @brief A copy of the second Matrix as of the last update.
+     */
+    Matrix<T> _secondSnapshot;
+
+    /**
+     * @brief The product as of the last update.
+     */
+    Matrix<T> _result;
+
+    /**
+     * @brief Compute the product of the Matrices from the beginning, and take new copies of
+     *        them. If the dimensions of the Matrices doesn't fit, an Exception will be thrown.
+     */
+    void _recompute();
+
+    /**
+     * @brief Apply the changes of the first Matrix, so the result is the product of the first
+     *        Matrix and the copy of the second Matrix.
+     * @param rows The changed rows of the first Matrix.
+     * @param cols The changed columns of the first Matrix.
+     */
+    void _updateFirst(const std::vector<unsigned int>& rows,
+                      const std::vector<unsigned int>& cols);
+
+    /**
+     * @brief Apply the changes of the second Matrix, so the result is the product of the
+     *        Matrices.
+     * @param rows The changed rows of the second Matrix.
+     * @param cols The changed columns of the second Matrix.
+     */
+    void _updateSecond(const std::vector<unsigned int>& rows,
+                       const std::vector<unsigned int>& cols);
+
+    /**
+     * @brief Copy the given rows or columns of the given Matrix into the given copy of it.
+     * @param matrix The Matrix to copy from.
+     * @param snapshot The copy of the Matrix.
+     * @param lines The rows or the columns to copy.
+     * @param byRows true if the lines are rows, false if they are columns.
+     */
+    static void _copyLines(const Matrix<T>& matrix, Matrix<T>& snapshot,
+                           const std::vector<unsigned int>& lines, bool byRows);
+};
+
+
+#include "MatrixProduct.hpp"
+
+#endif
@@ -0,0 +1,248 @@
+/**
+ * @file MatrixProduct.hpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 18 Oct 2026
+ *
+ * @brief An implementation of the Matrix Product Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * An implementation of the Matrix Product Class.
+ * The updates work directly on the cells of the result, and each of them supports the
+ * multithread mode of the Matrix, where each thread updates a contiguous block of rows.
+ */
+
+
+#ifndef _MATRIXPRODUCT_HPP
+#define _MATRIXPRODUCT_HPP
+
+
+/*-----=  Includes  =-----*/
+
+
+#include "MatrixProduct.h"
+
+
+/*-----=  Constructors  =-----*/
+
+
+/**
+ * @brief A Constructor for the product of the given Matrices, which turns on the tracking of
+ *        their changes and computes their product.
+ *        If the dimensions of the Matrices doesn't fit, an Exception will be thrown.
+ * @param first The first Matrix in the product (on the left side).
+ * @param second The second Matrix in the product (on the right side).
+ */
+template <class T>
+MatrixProduct<T>::MatrixProduct(Matrix<T>& first, Matrix<T>& second)
+        : _first(first), _second(second), _firstSnapshot(EMPTY_MATRIX_SIZE, EMPTY_MATRIX_SIZE),
+          _secondSnapshot(EMPTY_MATRIX_SIZE, EMPTY_MATRIX_SIZE),
+          _result(EMPTY_MATRIX_SIZE, EMPTY_MATRIX_SIZE)
+{
+    _recompute();
+    _first.setChangeTracking(true);
+    _second.setChangeTracking(true);
+}
+
+
+/*-----=  Product Update  =-----*/
+
+
+/**
+ * @brief Bring the product up to date with the changes of the Matrices since the last update,
+ *        and clear their changes. Each side is updated in the cheaper of it's two ways (by rows
+ *        or by a rank-k correction), and if both together cost as much as a full product, the
+ *        product is recomputed.
+ *        If the dimensions of the Matrices doesn't fit anymore, an Exception will be thrown.
+ * @return The updated product.
+ */
+template <class T>
+const Matrix<T>& MatrixProduct<T>::update()
+{
+    // The changes of Matrices which were resized (e.g. by an assignment) don't describe cells.
+    if (_first.rows() != _firstSnapshot.rows() || _first.cols() != _firstSnapshot.cols() ||
+        _second.rows() != _secondSnapshot.rows() || _second.cols() != _secondSnapshot.cols() ||
+        !_first.isTrackingChanges() || !_second.isTrackingChanges())
+    {
+        _recompute();
+        _first.setChangeTracking(true);
+        _second.setChangeTracking(true);
+        return _result;
+    }
+
+    const std::vector<unsigned int> firstRows = _first.changedRows();
+    const std::vector<unsigned int> firstCols = _first.changedCols();
+    const std::vector<unsigned int> secondRows = _second.changedRows();
+    const std::vector<unsigned int> secondCols = _second.changedCols();
+
+    // The costs are counted in multiplied cells, like the cost of a full product.
+    const double rows = _first.rows();
+    const double inner = _first.cols();
+    const double cols = _second.cols();
+    const double firstCost = std::min(firstRows.size() * inner, rows * firstCols.size()) * cols;
+    const double secondCost = rows * std::min(inner * secondCols.size(),
+                                              secondRows.size() * cols);
+    if (firstCost + secondCost >= rows * inner * cols)
+    {
+        _recompute();
+    }
+    else
+    {
+        if (!firstRows.empty())
+        {
+            _updateFirst(firstRows, firstCols);
+        }
+        if (!secondRows.empty())
+        {
+            _updateSecond(secondRows, secondCols);
+        }
+    }
+    _first.clearChanges();
+    _second.clearChanges();
+    return _result;
+}
+
+/**
+ * @brief Compute the product of the Matrices from the beginning, and take new copies of them.
+ *        The product is exact, like the incremental updates, and it bypasses the result cache.
+ *        If the dimensions of the Matrices doesn't fit, an Exception will be thrown.
+ */
+template <class T>
+void MatrixProduct<T>::_recompute()
+{
+    if (_first.cols() != _second.rows())
+    {
+        throw MatrixDimensionsException();
+    }
+    _result = Matrix<T>::_product(_first, _second, true);
+    _firstSnapshot = _first;
+    _secondSnapshot = _second;
+}
+
+/**
+ * @brief Apply the changes of the first Matrix, so the result is the product of the first
+ *        Matrix and the copy of the second Matrix. Either each changed row of the result is
+ *        multiplied again, or the difference of each changed column of the first Matrix times
+ *        the matching row of the second Matrix is added to the result, whichever is cheaper.
+ * @param rows The changed rows of the first Matrix.
+ * @param cols The changed columns of the first Matrix.
+ */
+template <class T>
+void MatrixProduct<T>::_updateFirst(const std::vector<unsigned int>& rows,
+                                    const std::vector<unsigned int>& cols)
+{
+    const Matrix<T>& first = _first;
+    const Matrix<T>& second = _secondSnapshot;
+    const bool byRows = (rows.size() * first._cols) <= (first._rows * cols.size());
+    _result._detach();
+    if (byRows)
+    {
+        Matrix<T>::_parallelFor((unsigned int) rows.size(),
+                                [&](unsigned int begin, unsigned int end)
+        {
+            for (unsigned int index = begin; index < end; index++)
+            {
+                Matrix<T>::_multiRowHelper(_result, first, second, rows[index], 0, second._cols);
+            }
+        });
+    }
+    else
+    {
+        Matrix<T>::_parallelFor(first._rows, [&](unsigned int begin, unsigned int end)
+        {
+            for (unsigned int row = begin; row < end; row++)
+            {
+                for (unsigned int k : cols)
+                {
+                    T difference(first._cell(row, k));
+                    difference -= _firstSnapshot._cell(row, k);
+                    for (unsigned int col = 0; col < second._cols; col++)
+                    {
+                        _result._cell(row, col) += difference * second._cell(k, col);
+                    }
+                }
+            }
+        });
+    }
+    _result._invalidateChecksum();
+    _copyLines(first, _firstSnapshot, byRows ? rows : cols, byRows);
+}
+
+/**
+ * @brief Apply the changes of the second Matrix, so the result is the product of the
+ *        Matrices. Either each changed column of the result is multiplied again, or the
+ *        column of the first Matrix times the difference of the matching changed row of the
+ *        second Matrix is added to the result, whichever is cheaper.
+ * @param rows The changed rows of the second Matrix.
+ * @param cols The changed columns of the second Matrix.
+ */
+template <class T>
+void MatrixProduct<T>::_updateSecond(const std::vector<unsigned int>& rows,
+                                     const std::vector<unsigned int>& cols)
+{
+    const Matrix<T>& first = _first;
+    const Matrix<T>& second = _second;
+    const bool byCols = (first._cols * cols.size()) <= (rows.size() * second._cols);
+    _result._detach();
+    Matrix<T>::_parallelFor(first._rows, [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int row = begin; row < end; row++)
+        {
+            if (byCols)
+            {
+                for (unsigned int col : cols)
+                {
+                    T sum(DEFAULT_VALUE);
+                    for (unsigned int k = 0; k < first._cols; k++)
+                    {
+                        sum += first._cell(row, k) * second._cell(k, col);
+                    }
+                    _result._cell(row, col) = sum;
+                }
+                continue;
+            }
+            for (unsigned int k : rows)
+            {
+                const T& scale = first._cell(row, k);
+                for (unsigned int col = 0; col < second._cols; col++)
+                {
+                    T difference(second._cell(k, col));
+                    difference -= _secondSnapshot._cell(k, col);
+                    _result._cell(row, col) += scale * difference;
+                }
+            }
+        }
+    });
+    _result._invalidateChecksum();
+    _copyLines(second, _secondSnapshot, byCols ? cols : rows, !byCols);
+}
+
+/**
+ * @brief Copy the given rows or columns of the given Matrix into the given copy of it.
+ * @param matrix The Matrix to copy from.
+ * @param snapshot The copy of the Matrix.
+ * @param lines The rows or the columns to copy.
+ * @param byRows true if the lines are rows, false if they are columns.
+ */
+template <class T>
+void MatrixProduct<T>::_copyLines(const Matrix<T>& matrix, Matrix<T>& snapshot,
+                                  const std::vector<unsigned int>& lines, bool byRows)
+{
+    snapshot._detach();
+    for (unsigned int line : lines)
+    {
+        const unsigned int length = byRows ? matrix._cols : matrix._rows;
+        for (unsigned int i = 0; i < length; i++)
+        {
+            const unsigned int row = byRows ? line : i;
+            const unsigned int col = byRows ? i : line;
+            snapshot._cell(row, col) = matrix._cell(row, col);
+        }
+    }
+    snapshot._invalidateChecksum();
+}
+
+#endif
@@ -0,0 +1,439 @@
+/**
+ * @file MatrixProtocol.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 18 Oct 2026
+ *
+ * @brief A Header File for the Matrix Protocol Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the Matrix Protocol Class.
+ * The Matrix Protocol is the binary protocol between the Matrix Daemon and it's clients, over a
+ * Unix domain socket. Both sides run on the same host, so all the numbers are sent in the byte
+ * order of the host. Each request is:
+ *      A Request Header - The operation, the element type, the number of names and (for a
+ *                         load) the dimensions of the Matrix.
+ *      The Names - Each name is it's length (16 bits) followed by it's characters.
+ *      The Cells - Only for a load, the cells of the Matrix in row order.
+ * Each response is:
+ *      A Response Header - The status and the dimensions of the result.
+ *      The Cells - Only for a successful store, the cells of the Matrix in row order.
+ * The names of the operations are from the side of the daemon: a load puts a Matrix into the
+ * daemon, and a store sends it back. The names of the operations are:
+ *      load <name>, store <name>, drop <name>, transpose <result> <source>,
+ *      add / subtract / multiply <result> <first> <second>.
+ * The Matrices of each element type have their own names.
+ */
+
+
+#ifndef _MATRIXPROTOCOL_H
+#define _MATRIXPROTOCOL_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <cstdint>
+#include <cerrno>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include "Matrix.h"
+#include "Complex.h"
+#include "MatrixException.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def DEFAULT_DAEMON_SOCKET "/tmp/matrixd.sock"
+ * @brief A Macro that sets the default path of the socket of the Matrix Daemon.
+ */
+#define DEFAULT_DAEMON_SOCKET "/tmp/matrixd.sock"
+
+/**
+ * @def MAX_DAEMON_CELLS 16777216
+ * @brief A Macro that sets the default largest number of cells in a Matrix which is sent to
+ *        the daemon (the daemon may be started with another limit).
+ */
+#define MAX_DAEMON_CELLS 16777216
+
+/**
+ * @def DAEMON_CHUNK_BYTES 1048576
+ * @brief A Macro that sets the number of bytes of cells which are sent or received at once.
+ */
+#define DAEMON_CHUNK_BYTES 1048576
+
+
+/*-----=  Enums  =-----*/
+
+
+/**
+ * @brief An Enum of the operations of the Matrix Daemon.
+ */
+enum MatrixDaemonOperation
+{
+    DAEMON_LOAD = 1,
+    DAEMON_STORE,
+    DAEMON_DROP,
+    DAEMON_TRANSPOSE,
+    DAEMON_ADD,
+    DAEMON_SUBTRACT,
+    DAEMON_MULTIPLY
+};
+
+/**
+ * @brief An Enum of the statuses of the responses of the Matrix Daemon.
+ *        After a DAEMON_REQUEST_ERROR (a request which cannot be read) the daemon closes the
+ *        connection, and after the errors of an operation it serves the next request.
+ */
+enum MatrixDaemonStatus
+{
+    DAEMON_OK = 0,
+    DAEMON_DIMENSIONS_ERROR,
+    DAEMON_OVERFLOW_ERROR,
+    DAEMON_NAME_ERROR,
+    DAEMON_REQUEST_ERROR
+};
+
+/**
+ * @brief An Enum of the element types of the Matrices of the Matrix Daemon.
+ */
+enum MatrixElementType
+{
+    INT_ELEMENTS = 1,
+    DOUBLE_ELEMENTS,
+    COMPLEX_ELEMENTS
+};
+
+
+/*-----=  Class Definition  =-----*/
+
+
+/**
+ * @brief A Struct representing the header of a request to the Matrix Daemon.
+ */
+struct MatrixRequestHeader
+{
+    std::uint8_t operation;
+    std::uint8_t type;
+    std::uint8_t names;
+    std::uint8_t reserved;
+    std::uint32_t rows;
+    std::uint32_t cols;
+};
+
+/**
+ * @brief A Struct representing the header of a response of the Matrix Daemon.
+ */
+struct MatrixResponseHeader
+{
+    std::uint8_t status;
+    std::uint8_t reserved[3];
+    std::uint32_t rows;
+    std::uint32_t cols;
+};
+
+static_assert(sizeof(MatrixRequestHeader) == 12 && sizeof(MatrixResponseHeader) == 12,
+              "The headers of the Matrix Protocol must not have padding");
+
+
+/**
+ * @brief A Struct which maps the element types of the Matrices to the element types of the
+ *        protocol. Only int, double and Complex Matrices may be sent.
+ */
+template <class T>
+struct MatrixElement;
+
+template <>
+struct MatrixElement<int>
+{
+    static const MatrixElementType type = INT_ELEMENTS;
+};
+
+template <>
+struct MatrixElement<double>
+{
+    static const MatrixElementType type = DOUBLE_ELEMENTS;
+};
+
+template <>
+struct MatrixElement<Complex>
+{
+    static const MatrixElementType type = COMPLEX_ELEMENTS;
+};
+
+
+/**
+ * @brief A Class which groups the functions of the Matrix Protocol, which are shared by the
+ *        daemon and it's clients. A failure of the socket throws a Matrix Daemon Exception.
+ */
+class MatrixProtocol
+{
+public:
+
+    /**
+     * @brief Returns the number of names in a request of the given operation.
+     * @param operation The operation.
+     * @return The number of names, or 0 for an unknown operation.
+     */
+    static unsigned int names(std::uint8_t operation);
+
+    /**
+     * @brief Send the given bytes to the given socket.
+     * @param socket The socket.
+     * @param data The bytes to send.
+     * @param bytes The number of bytes.
+     */
+    static void send(int socket, const void *data, std::size_t bytes);
+
+    /**
+     * @brief Receive the given number of bytes from the given socket.
+     * @param socket The socket.
+     * @param data The buffer of the bytes.
+     * @param bytes The number of bytes.
+     * @return true if the bytes were received, false if the other side has closed the
+     *         connection before the first byte.
+     */
+    static bool receive(int socket, void *data, std::size_t bytes);
+
+    /**
+     * @brief Send the given name to the given socket.
+     * @param socket The socket.
+     * @param name The name.
+     */
+    static void sendName(int socket, const std::string& name);
+
+    /**
+     * @brief Receive a name from the given socket.
+     * @param socket The socket.
+     * @return The name.
+     */
+    static std::string receiveName(int socket);
+
+    /**
+     * @brief Determine if a Matrix with the given dimensions may be sent.
+     * @param rows The number of rows.
+     * @param cols The number of columns.
+     * @param maxCells The largest number of cells in a Matrix.
+     * @return true if the Matrix may be sent, false otherwise.
+     */
+    static bool validDimensions(std::uint32_t rows, std::uint32_t cols,
+                                std::uint64_t maxCells = MAX_DAEMON_CELLS)
+    {
+        return rows > 0 && cols > 0 && (std::uint64_t) rows * cols <= maxCells;
+    };
+
+    /**
+     * @brief Send the cells of the given Matrix to the given socket, in row order.
+     *        The cells of a Matrix which is not packed in row order are sent through a buffer
+     *        of DAEMON_CHUNK_BYTES.
+     * @param socket The socket.
+     * @param matrix The Matrix.
+     */
+    template <class T>
+    static void sendCells(int socket, const Matrix<T>& matrix);
+
+    /**
+     * @brief Receive the cells of a Matrix with the given dimensions from the given socket.
+     *        The cells are received in chunks of DAEMON_CHUNK_BYTES straight into the Matrix.
+     * @param socket The socket.
+     * @param rows The number of rows.
+     * @param cols The number of columns.
+     * @return The received Matrix.
+     */
+    template <class T>
+    static Matrix<T> receiveCells(int socket, std::uint32_t rows, std::uint32_t cols);
+};
+
+
+/*-----=  Implementation  =-----*/
+
+
+/**
+ * @brief Returns the number of names in a request of the given operation.
+ * @param operation The operation.
+ * @return The number of names, or 0 for an unknown operation.
+ */
+inline unsigned int MatrixProtocol::names(std::uint8_t operation)
+{
+    switch (operation)
+    {
+        case DAEMON_LOAD:
+        case DAEMON_STORE:
+        case DAEMON_DROP:
+            return 1;
+        case DAEMON_TRANSPOSE:
+            return 2;
+        case DAEMON_ADD:
+        case DAEMON_SUBTRACT:
+        case DAEMON_MULTIPLY:
+            return 3;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief Send the given bytes to the given socket.
+ * @param socket The socket.
+ * @param data The bytes to send.
+ * @param bytes The number of bytes.
+ */
+inline void MatrixProtocol::send(int socket, const void *data, std::size_t bytes)
+{
+    const char *position = (const char *) data;
+    while (bytes > 0)
+    {
+        // A closed connection is reported as an error instead of a SIGPIPE.
+        ssize_t sent = ::send(socket, position, bytes, MSG_NOSIGNAL);
+        if (sent < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (sent <= 0)
+        {
+            throw MatrixDaemonException();
+        }
+        position += sent;
+        bytes -= (std::size_t) sent;
+    }
+}
+
+/**
+ * @brief Receive the given number of bytes from the given socket.
+ * @param socket The socket.
+ * @param data The buffer of the bytes.
+ * @param bytes The number of bytes.
+ * @return true if the bytes were received, false if the other side has closed the connection
+ *         before the first byte.
+ */
+inline bool MatrixProtocol::receive(int socket, void *data, std::size_t bytes)
+{
+    char *position = (char *) data;
+    bool started = false;
+    while (bytes > 0)
+    {
+        ssize_t received = ::recv(socket, position, bytes, 0);
+        if (received < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (received == 0 && !started)
+        {
+            return false;
+        }
+        if (received <= 0)
+        {
+            throw MatrixDaemonException();
+        }
+        started = true;
+        position += received;
+        bytes -= (std::size_t) received;
+    }
+    return true;
+}
+
+/**
+ * @brief Send the given name to the given socket.
+ * @param socket The socket.
+ * @param name The name.
+ */
+inline void MatrixProtocol::sendName(int socket, const std::string& name)
+{
+    if (name.size() > UINT16_MAX)
+    {
+        throw MatrixDaemonException();
+    }
+    const std::uint16_t length = (std::uint16_t) name.size();
+    send(socket, &length, sizeof(length));
+    send(socket, name.data(), name.size());
+}
+
+/**
+ * @brief Receive a name from the given socket.
+ * @param socket The socket.
+ * @return The name.
+ */
+inline std::string MatrixProtocol::receiveName(int socket)
+{
+    std::uint16_t length = 0;
+    if (!receive(socket, &length, sizeof(length)))
+    {
+        throw MatrixDaemonException();
+    }
+    std::string name(length, '\0');
+    if (length > 0 && !receive(socket, &name[0], length))
+    {
+        throw MatrixDaemonException();
+    }
+    return name;
+}
+
+/**
+ * @brief Send the cells of the given Matrix to the given socket, in row order.
+ *        The cells of a Matrix which is not packed in row order are sent through a buffer of
+ *        DAEMON_CHUNK_BYTES.
+ * @param socket The socket.
+ * @param matrix The Matrix.
+ */
+template <class T>
+void MatrixProtocol::sendCells(int socket, const Matrix<T>& matrix)
+{
+    const std::size_t count = (std::size_t) matrix.rows() * matrix.cols();
+    const MatrixBuffer<const T> memory = matrix.buffer();
+    if (memory.layout == ROW_MAJOR && memory.stride == matrix.cols())
+    {
+        send(socket, memory.data, count * sizeof(T));
+        return;
+    }
+
+    std::vector<T> chunk;
+    chunk.reserve(std::min(count, std::max((std::size_t) 1, DAEMON_CHUNK_BYTES / sizeof(T))));
+    for (typename Matrix<T>::const_iterator cell = matrix.begin(); cell != matrix.end(); ++cell)
+    {
+        chunk.push_back(*cell);
+        if (chunk.size() == chunk.capacity())
+        {
+            send(socket, chunk.data(), chunk.size() * sizeof(T));
+            chunk.clear();
+        }
+    }
+    send(socket, chunk.data(), chunk.size() * sizeof(T));
+}
+
+/**
+ * @brief Receive the cells of a Matrix with the given dimensions from the given socket.
+ *        The cells are received in chunks of DAEMON_CHUNK_BYTES straight into the Matrix.
+ * @param socket The socket.
+ * @param rows The number of rows.
+ * @param cols The number of columns.
+ * @return The received Matrix.
+ */
+template <class T>
+Matrix<T> MatrixProtocol::receiveCells(int socket, std::uint32_t rows, std::uint32_t cols)
+{
+    // A new Matrix is packed in row order, like the cells which are sent.
+    Matrix<T> matrix(rows, cols);
+    char *position = (char *) matrix.buffer().data;
+    std::size_t bytes = (std::size_t) rows * cols * sizeof(T);
+    while (bytes > 0)
+    {
+        const std::size_t chunk = std::min(bytes, (std::size_t) DAEMON_CHUNK_BYTES);
+        if (!receive(socket, position, chunk))
+        {
+            throw MatrixDaemonException();
+        }
+        position += chunk;
+        bytes -= chunk;
+    }
+    return matrix;
+}
+
+#endif
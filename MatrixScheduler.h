@@ -0,0 +1,470 @@
+/**
+ * @file MatrixScheduler.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 18 Oct 2026
+ *
+ * @brief A Header File for the Matrix Scheduler Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the Matrix Scheduler Class.
+ * The Matrix Scheduler performs the ranges of the Matrix parallel mode by work stealing, for
+ * operations whose rows (or columns) don't cost the same (e.g. the triangular updates of the
+ * decompositions). Each worker has it's own deque of ranges: it splits it's range in halves,
+ * pushes the upper half to the back of it's deque and continues with the lower half, until the
+ * range is small enough to perform. A worker whose deque is empty steals the front range (the
+ * largest one) from the deque of a random victim, so no worker is idle while ranges remain.
+ * The workers are created on the first use and live until the end of the program.
+ */
+
+
+#ifndef _MATRIXSCHEDULER_H
+#define _MATRIXSCHEDULER_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <random>
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def STEAL_SPLIT_FACTOR 8
+ * @brief A Macro that sets the number of ranges per worker which a range is split into, so a
+ *        range is not split below (size / (workers * STEAL_SPLIT_FACTOR)) indices.
+ */
+#define STEAL_SPLIT_FACTOR 8
+
+
+/*-----=  Class Definition  =-----*/
+
+
+/**
+ * @brief A Class representing a work stealing scheduler, which performs a task on the blocks
+ *        of a range with a set of worker threads. A single range is performed at a time.
+ */
+class MatrixScheduler
+{
+public:
+
+    /**
+     * @brief The type of the task, which receives the beginning and the end of a block.
+     */
+    typedef std::function<void(unsigned int, unsigned int)> Task;
+
+    /**
+     * @brief Returns the scheduler which is shared by all the Matrix operations.
+     * @return The shared scheduler.
+     */
+    static MatrixScheduler& shared()
+    {
+        static MatrixScheduler scheduler;
+        return scheduler;
+    };
+
+    /**
+     * @brief The Destructor for the scheduler, which joins the workers.
+     */
+    ~MatrixScheduler();
+
+    /**
+     * @brief Determine if the calling thread is performing a range of the scheduler. A task
+     *        which performs another parallel operation must perform it by itself, since the
+     *        scheduler performs a single range at a time.
+     * @return true if the calling thread is performing a range, false otherwise.
+     */
+    static bool isWorker() { return _workerFlag(); };
+
+    /**
+     * @brief Perform the given task on the range [0, count) with the given number of workers
+     *        (including the calling thread), and return when all of the range was performed.
+     *        The ranges run one at a time, so a call from another thread waits until the
+     *        current range is over. The task must not throw an Exception.
+     * @param count The size of the range.
+     * @param workers The number of workers.
+     * @param task The task to perform, which receives the beginning and the end of a block.
+     */
+    void run(unsigned int count, unsigned int workers, const Task& task);
+
+private:
+
+    /**
+     * @brief A Struct representing a block of the range which is not performed yet.
+     */
+    struct Block
+    {
+        unsigned int begin;
+        unsigned int end;
+    };
+
+    /**
+     * @brief A Struct representing the deque of blocks of a single worker.
+     */
+    struct Deque
+    {
+        std::mutex mutex;
+        std::deque<Block> blocks;
+    };
+
+    /**
+     * @brief The background worker threads (the calling thread of run() is worker 0).
+     */
+    std::vector<std::thread> _workers;
+
+    /**
+     * @brief The deques of the workers, including the calling thread.
+     */
+    std::vector<std::unique_ptr<Deque>> _deques;
+
+    /**
+     * @brief A mutex which makes the ranges run one at a time.
+     */
+    std::mutex _runMutex;
+
+    /**
+     * @brief A mutex which guards the state of the current range.
+     */
+    std::mutex _mutex;
+
+    /**
+     * @brief A condition which is notified when a range starts or the scheduler is stopping.
+     */
+    std::condition_variable _rangeStarted;
+
+    /**
+     * @brief A condition which is notified when a background worker leaves the current range.
+     */
+    std::condition_variable _workerLeft;
+
+    /**
+     * @brief The task of the current range.
+     */
+    const Task *_task;
+
+    /**
+     * @brief The least size of a block which is split.
+     */
+    unsigned int _grain;
+
+    /**
+     * @brief The number of workers of the current range.
+     */
+    unsigned int _participants;
+
+    /**
+     * @brief The number of ranges which were started, so a worker joins each range once.
+     */
+    unsigned long _generation;
+
+    /**
+     * @brief A flag which determine if background workers may join the current range.
+     */
+    bool _open;
+
+    /**
+     * @brief The number of background workers which are in the current range.
+     */
+    unsigned int _active;
+
+    /**
+     * @brief A flag which determine if the scheduler is stopping.
+     */
+    bool _stopping;
+
+    /**
+     * @brief The number of indices of the current range which are not performed yet.
+     */
+    std::atomic<unsigned int> _remaining;
+
+    /**
+     * @brief The Constructor for a scheduler without workers, which are started on demand.
+     */
+    MatrixScheduler() : _task(nullptr), _grain(1), _participants(0), _generation(0),
+                        _open(false), _active(0), _stopping(false), _remaining(0) { };
+
+    /**
+     * @brief A scheduler owns it's workers, so it cannot be copied.
+     */
+    MatrixScheduler(const MatrixScheduler& other) = delete;
+
+    /**
+     * @brief A scheduler owns it's workers, so it cannot be assigned.
+     */
+    MatrixScheduler& operator=(const MatrixScheduler& other) = delete;
+
+    /**
+     * @brief Gives access to the flag of the calling thread which determine if it is
+     *        performing a range of the scheduler.
+     * @return Access to the flag of the calling thread.
+     */
+    static bool& _workerFlag()
+    {
+        static thread_local bool isWorker = false;
+        return isWorker;
+    };
+
+    /**
+     * @brief The loop of a background worker, which joins each range until the scheduler is
+     *        stopping.
+     * @param index The index of the worker.
+     */
+    void _work(unsigned int index);
+
+    /**
+     * @brief Perform blocks of the current range (from the own deque, or stolen from other
+     *        workers) until all of the range was performed.
+     * @param index The index of the worker.
+     */
+    void _participate(unsigned int index);
+
+    /**
+     * @brief Take the block at the back of the deque of the given worker.
+     * @param index The index of the worker.
+     * @param block The taken block.
+     * @return true if a block was taken, false if the deque is empty.
+     */
+    bool _pop(unsigned int index, Block& block);
+
+    /**
+     * @brief Steal the block at the front of the deque of a random victim. The victims are
+     *        tried in order from the random one, until a block is found.
+     * @param index The index of the stealing worker.
+     * @param generator The random generator of the stealing worker.
+     * @param block The stolen block.
+     * @return true if a block was stolen, false if all the deques are empty.
+     */
+    bool _steal(unsigned int index, std::minstd_rand& generator, Block& block);
+
+    /**
+     * @brief Split the given block in halves until it is smaller than the grain (pushing the
+     *        upper halves to the back of the deque of the given worker), and perform it.
+     * @param index The index of the worker.
+     * @param block The block to perform.
+     */
+    void _execute(unsigned int index, Block block);
+};
+
+
+/*-----=  Implementation  =-----*/
+
+
+/**
+ * @brief The Destructor for the scheduler, which joins the workers.
+ */
+inline MatrixScheduler::~MatrixScheduler()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _rangeStarted.notify_all();
+    for (std::thread& worker : _workers)
+    {
+        worker.join();
+    }
+}
+
+/**
+ * @brief Perform the given task on the range [0, count) with the given number of workers
+ *        (including the calling thread), and return when all of the range was performed.
+ *        The ranges run one at a time, so a call from another thread waits until the current
+ *        range is over. The task must not throw an Exception.
+ * @param count The size of the range.
+ * @param workers The number of workers.
+ * @param task The task to perform, which receives the beginning and the end of a block.
+ */
+inline void MatrixScheduler::run(unsigned int count, unsigned int workers, const Task& task)
+{
+    if (count == 0)
+    {
+        return;
+    }
+    if (workers <= 1)
+    {
+        task(0, count);
+        return;
+    }
+
+    std::lock_guard<std::mutex> runLock(_runMutex);
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        // The background workers are idle between the ranges, so they may be added now.
+        while (_deques.size() < workers)
+        {
+            _deques.push_back(std::unique_ptr<Deque>(new Deque()));
+        }
+        while (_workers.size() + 1 < workers)
+        {
+            _workers.push_back(std::thread(&MatrixScheduler::_work, this,
+                                           (unsigned int) _workers.size() + 1));
+        }
+
+        _task = &task;
+        _grain = std::max(1u, count / (workers * STEAL_SPLIT_FACTOR));
+        _participants = workers;
+        _remaining = count;
+        _deques[0] -> blocks.push_back(Block{0, count});
+        _generation++;
+        _open = true;
+    }
+    _rangeStarted.notify_all();
+
+    _participate(0);
+
+    // No background worker may touch the task after the range is over.
+    std::unique_lock<std::mutex> lock(_mutex);
+    _open = false;
+    _workerLeft.wait(lock, [this]() { return _active == 0; });
+}
+
+/**
+ * @brief The loop of a background worker, which joins each range until the scheduler is
+ *        stopping.
+ * @param index The index of the worker.
+ */
+inline void MatrixScheduler::_work(unsigned int index)
+{
+    unsigned long joined = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _rangeStarted.wait(lock, [&]()
+            {
+                return _stopping || _generation != joined;
+            });
+            if (_stopping)
+            {
+                return;
+            }
+            joined = _generation;
+            if (!_open || index >= _participants)
+            {
+                continue;
+            }
+            _active++;
+        }
+
+        _participate(index);
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _active--;
+        }
+        _workerLeft.notify_all();
+    }
+}
+
+/**
+ * @brief Perform blocks of the current range (from the own deque, or stolen from other
+ *        workers) until all of the range was performed.
+ * @param index The index of the worker.
+ */
+inline void MatrixScheduler::_participate(unsigned int index)
+{
+    _workerFlag() = true;
+    std::minstd_rand generator(index + 1);
+    Block block;
+    while (_remaining.load() > 0)
+    {
+        if (_pop(index, block) || _steal(index, generator, block))
+        {
+            _execute(index, block);
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+    _workerFlag() = false;
+}
+
+/**
+ * @brief Take the block at the back of the deque of the given worker.
+ * @param index The index of the worker.
+ * @param block The taken block.
+ * @return true if a block was taken, false if the deque is empty.
+ */
+inline bool MatrixScheduler::_pop(unsigned int index, Block& block)
+{
+    Deque& deque = *_deques[index];
+    std::lock_guard<std::mutex> lock(deque.mutex);
+    if (deque.blocks.empty())
+    {
+        return false;
+    }
+    block = deque.blocks.back();
+    deque.blocks.pop_back();
+    return true;
+}
+
+/**
+ * @brief Steal the block at the front of the deque of a random victim. The victims are tried
+ *        in order from the random one, until a block is found.
+ * @param index The index of the stealing worker.
+ * @param generator The random generator of the stealing worker.
+ * @param block The stolen block.
+ * @return true if a block was stolen, false if all the deques are empty.
+ */
+inline bool MatrixScheduler::_steal(unsigned int index, std::minstd_rand& generator,
+                                    Block& block)
+{
+    const unsigned int first = (unsigned int) (generator() % _participants);
+    for (unsigned int offset = 0; offset < _participants; offset++)
+    {
+        const unsigned int victim = (first + offset) % _participants;
+        if (victim == index)
+        {
+            continue;
+        }
+        Deque& deque = *_deques[victim];
+        std::lock_guard<std::mutex> lock(deque.mutex);
+        if (!deque.blocks.empty())
+        {
+            block = deque.blocks.front();
+            deque.blocks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Split the given block in halves until it is smaller than the grain (pushing the upper
+ *        halves to the back of the deque of the given worker), and perform it.
+ * @param index The index of the worker.
+ * @param block The block to perform.
+ */
+inline void MatrixScheduler::_execute(unsigned int index, Block block)
+{
+    while (block.end - block.begin > _grain)
+    {
+        const unsigned int middle = block.begin + ((block.end - block.begin) / 2);
+        {
+            Deque& deque = *_deques[index];
+            std::lock_guard<std::mutex> lock(deque.mutex);
+            deque.blocks.push_back(Block{middle, block.end});
+        }
+        block.end = middle;
+    }
+    (*_task)(block.begin, block.end);
+    _remaining -= block.end - block.begin;
+}
+
+#endif
@@ -0,0 +1,485 @@
+/**
+ * @file MatrixStorage.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 18 Oct 2026
+ *
+ * @brief A Header File for the Matrix Storage Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the Matrix Storage Class.
+ * The Matrix Storage holds the cells of a Matrix. The cells are either owned by the storage
+ * (in a buffer which is allocated with the First Touch Allocator) or they are memory of the
+ * user which the Matrix adopted without copying it, in which case the storage only refers to
+ * them and the user must keep them alive while the Matrix uses them.
+ * Copies of a storage refer to the same cells, so the Matrix decides when the cells are
+ * duplicated (see clone()), and it never shares cells which it gave references to (see
+ * expose()).
+ * The Matrix Iterator reads the cells of a Matrix in row order, whatever their strides in the
+ * storage are.
+ * The Matrix Changes records which rows and columns of a Matrix were changed, for the Matrices
+ * which track their changes.
+ */
+
+
+#ifndef _MATRIXSTORAGE_H
+#define _MATRIXSTORAGE_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <vector>
+#include <memory>
+#include <iterator>
+#include <cstddef>
+#include <atomic>
+#include "MatrixTopology.h"
+
+
+/*-----=  Class Definition  =-----*/
+
+
+/**
+ * @brief A Class representing the cells of a Matrix, either owned or adopted from the user.
+ */
+template <class T>
+class MatrixStorage
+{
+public:
+
+    /**
+     * @brief The type of the buffer of an owned storage.
+     */
+    typedef std::vector<T, FirstTouchAllocator<T>> Buffer;
+
+    /**
+     * @brief The Default Constructor for an empty storage.
+     */
+    MatrixStorage() : _data(nullptr), _size(0), _exposed(false) { };
+
+    /**
+     * @brief A Constructor for an owned storage of the given number of cells, which are
+     *        default-initialized (i.e. not touched for plain element types).
+     * @param size The number of cells.
+     */
+    explicit MatrixStorage(std::size_t size)
+            : _buffer(std::make_shared<Buffer>(size)), _data(_buffer -> data()), _size(size),
+              _exposed(false) { };
+
+    /**
+     * @brief A Constructor for an owned storage which holds a copy of the given range of cells.
+     * @param first The beginning of the range.
+     * @param last The end of the range.
+     */
+    template <class Iterator>
+    MatrixStorage(Iterator first, Iterator last)
+            : _buffer(std::make_shared<Buffer>(first, last)), _data(_buffer -> data()),
+              _size(_buffer -> size()), _exposed(false) { };
+
+    /**
+     * @brief A Constructor for a storage which refers to the given cells of the user, without
+     *        owning or copying them.
+     * @param data The first cell.
+     * @param size The number of cells which the storage may access.
+     */
+    MatrixStorage(T *data, std::size_t size) : _data(data), _size(size), _exposed(false) { };
+
+    /**
+     * @brief A Copy Constructor for a storage which refers to the same cells as the given one.
+     * @param other The storage to copy.
+     */
+    MatrixStorage(const MatrixStorage<T>& other)
+            : _buffer(other._buffer), _data(other._data), _size(other._size),
+              _exposed(other.isExposed()) { };
+
+    /**
+     * @brief A Move Constructor for a storage which takes the cells of the given one.
+     * @param other The storage to move.
+     */
+    MatrixStorage(MatrixStorage<T>&& other)
+            : _buffer(std::move(other._buffer)), _data(other._data), _size(other._size),
+              _exposed(other.isExposed()) { };
+
+    /**
+     * @brief An operator overload for the assignment operator '='.
+     *        The operator makes this storage refer to the same cells as the given one.
+     * @param other The storage to assign to this storage.
+     * @return This storage after the assignment.
+     */
+    MatrixStorage<T>& operator=(const MatrixStorage<T>& other)
+    {
+        _buffer = other._buffer;
+        _data = other._data;
+        _size = other._size;
+        _exposed.store(other.isExposed(), std::memory_order_relaxed);
+        return *this;
+    };
+
+    /**
+     * @brief An operator overload for the move assignment operator '='.
+     *        The operator makes this storage take the cells of the given one.
+     * @param other The storage to move to this storage.
+     * @return This storage after the assignment.
+     */
+    MatrixStorage<T>& operator=(MatrixStorage<T>&& other)
+    {
+        _buffer = std::move(other._buffer);
+        _data = other._data;
+        _size = other._size;
+        _exposed.store(other.isExposed(), std::memory_order_relaxed);
+        return *this;
+    };
+
+    /**
+     * @brief Returns a pointer to the first cell.
+     * @return A pointer to the first cell.
+     */
+    T *data() { return _data; };
+
+    /**
+     * @brief Returns a read-only pointer to the first cell.
+     * @return A read-only pointer to the first cell.
+     */
+    const T *data() const { return _data; };
+
+    /**
+     * @brief Returns the number of cells in the storage.
+     * @return The number of cells in the storage.
+     */
+    std::size_t size() const { return _size; };
+
+    /**
+     * @brief Gives access to the cell at the given index.
+     * @param index The index of the cell.
+     * @return Access to the cell.
+     */
+    T& operator[](std::size_t index) { return _data[index]; };
+
+    /**
+     * @brief Gives read-only access to the cell at the given index.
+     * @param index The index of the cell.
+     * @return A read-only access to the cell.
+     */
+    const T& operator[](std::size_t index) const { return _data[index]; };
+
+    /**
+     * @brief Returns a pointer to the first cell.
+     * @return A pointer to the first cell.
+     */
+    T *begin() { return _data; };
+
+    /**
+     * @brief Returns a pointer past the last cell.
+     * @return A pointer past the last cell.
+     */
+    T *end() { return _data + _size; };
+
+    /**
+     * @brief Returns a read-only pointer to the first cell.
+     * @return A read-only pointer to the first cell.
+     */
+    const T *begin() const { return _data; };
+
+    /**
+     * @brief Returns a read-only pointer past the last cell.
+     * @return A read-only pointer past the last cell.
+     */
+    const T *end() const { return _data + _size; };
+
+    /**
+     * @brief Determine if the cells are owned by the storage (and not adopted from the user).
+     * @return true if the cells are owned, false otherwise.
+     */
+    bool isOwner() const { return (bool) _buffer; };
+
+    /**
+     * @brief Determine if the owned cells are shared with another storage. The number of
+     *        sharing storages is counted atomically, so storages may be copied and destroyed
+     *        concurrently. The answer may be stale once it returns, so a storage which is
+     *        changed by several threads must be made unshared (by clone()) before.
+     * @return true if the owned cells are shared, false otherwise.
+     */
+    bool isShared() const { return _buffer && _buffer.use_count() > 1; };
+
+    /**
+     * @brief Mark the cells as exposed, i.e. references to them (or their memory) were given
+     *        out and may be used to change them at any time, so they must not be shared with
+     *        another storage from now on. A clone of the storage is not exposed.
+     *        The flag is atomic, since threads may change different cells of the same storage
+     *        concurrently.
+     */
+    void expose() { _exposed.store(true, std::memory_order_relaxed); };
+
+    /**
+     * @brief Determine if references to the cells were given out (see expose()).
+     * @return true if the cells are exposed, false otherwise.
+     */
+    bool isExposed() const { return _exposed.load(std::memory_order_relaxed); };
+
+    /**
+     * @brief Returns an owned storage which holds a copy of the cells.
+     * @return An owned copy of the storage.
+     */
+    MatrixStorage<T> clone() const { return MatrixStorage<T>(begin(), end()); };
+
+    /**
+     * @brief Change the number of cells in the storage.
+     *        A storage which is the only owner of it's buffer keeps the cells in the new size,
+     *        otherwise it gets a new buffer and the previous cells are not kept.
+     * @param size The new number of cells.
+     */
+    void resize(std::size_t size)
+    {
+        if (_buffer && _buffer.use_count() == 1)
+        {
+            _buffer -> resize(size);
+            _data = _buffer -> data();
+            _size = size;
+            return;
+        }
+        *this = MatrixStorage<T>(size);
+    };
+
+private:
+
+    /**
+     * @brief The buffer of an owned storage, or null if the cells are adopted from the user.
+     */
+    std::shared_ptr<Buffer> _buffer;
+
+    /**
+     * @brief The first cell.
+     */
+    T *_data;
+
+    /**
+     * @brief The number of cells in the storage.
+     */
+    std::size_t _size;
+
+    /**
+     * @brief A flag which determine if references to the cells were given out.
+     */
+    std::atomic<bool> _exposed;
+};
+
+
+/**
+ * @brief A Class representing a constant iterator over the cells of a Matrix in row order.
+ *        The cells are located by the strides of the Matrix, so the iterator works for any
+ *        layout, and for the packed row order layout it simply advances a pointer.
+ */
+template <class T>
+class MatrixIterator
+{
+public:
+
+    /**
+     * @brief The types of the iterator, as required by the standard algorithms.
+     */
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef T value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const T *pointer;
+    typedef const T& reference;
+
+    /**
+     * @brief The Default Constructor for an iterator which doesn't refer to any Matrix.
+     */
+    MatrixIterator() : _data(nullptr), _cols(1), _rowStride(0), _colStride(0), _index(0) { };
+
+    /**
+     * @brief A Constructor for an iterator over the cells of a Matrix.
+     * @param data The first cell of the Matrix.
+     * @param cols The number of columns in the Matrix.
+     * @param rowStride The distance between two consecutive rows in the storage.
+     * @param colStride The distance between two consecutive columns in the storage.
+     * @param index The index (in row order) of the cell which the iterator refers to.
+     */
+    MatrixIterator(const T *data, unsigned int cols, std::size_t rowStride,
+                   std::size_t colStride, std::size_t index)
+            : _data(data), _cols(cols == 0 ? 1 : cols), _rowStride(rowStride),
+              _colStride(colStride), _index(index) { };
+
+    reference operator*() const { return (*this)[0]; };
+    pointer operator->() const { return &(*this)[0]; };
+
+    reference operator[](difference_type offset) const
+    {
+        std::size_t index = _index + offset;
+        if (_colStride == 1 && _rowStride == _cols)
+        {
+            return _data[index];
+        }
+        return _data[((index / _cols) * _rowStride) + ((index % _cols) * _colStride)];
+    };
+
+    MatrixIterator& operator++() { _index++; return *this; };
+    MatrixIterator& operator--() { _index--; return *this; };
+    MatrixIterator operator++(int) { MatrixIterator previous(*this); _index++; return previous; };
+    MatrixIterator operator--(int) { MatrixIterator previous(*this); _index--; return previous; };
+    MatrixIterator& operator+=(difference_type offset) { _index += offset; return *this; };
+    MatrixIterator& operator-=(difference_type offset) { _index -= offset; return *this; };
+
+    MatrixIterator operator+(difference_type offset) const
+    {
+        return MatrixIterator(*this) += offset;
+    };
+
+    MatrixIterator operator-(difference_type offset) const
+    {
+        return MatrixIterator(*this) -= offset;
+    };
+
+    difference_type operator-(const MatrixIterator& other) const
+    {
+        return (difference_type) _index - (difference_type) other._index;
+    };
+
+    bool operator==(const MatrixIterator& other) const { return _index == other._index; };
+    bool operator!=(const MatrixIterator& other) const { return _index != other._index; };
+    bool operator<(const MatrixIterator& other) const { return _index < other._index; };
+    bool operator>(const MatrixIterator& other) const { return _index > other._index; };
+    bool operator<=(const MatrixIterator& other) const { return _index <= other._index; };
+    bool operator>=(const MatrixIterator& other) const { return _index >= other._index; };
+
+private:
+
+    /**
+     * @brief The first cell of the Matrix.
+     */
+    const T *_data;
+
+    /**
+     * @brief The number of columns in the Matrix (at least one).
+     */
+    std::size_t _cols;
+
+    /**
+     * @brief The distance between two consecutive rows in the storage.
+     */
+    std::size_t _rowStride;
+
+    /**
+     * @brief The distance between two consecutive columns in the storage.
+     */
+    std::size_t _colStride;
+
+    /**
+     * @brief The index (in row order) of the cell which the iterator refers to.
+     */
+    std::size_t _index;
+};
+
+
+/**
+ * @brief A Class representing the rows and the columns of a Matrix which were changed since
+ *        the changes were last cleared. A change which isn't of a single cell (e.g. an
+ *        assignment) marks all the rows and columns as changed.
+ */
+class MatrixChanges
+{
+public:
+
+    /**
+     * @brief A Constructor for the changes of a Matrix of the given dimensions, without any
+     *        changed rows or columns.
+     * @param rows The number of rows in the Matrix.
+     * @param cols The number of columns in the Matrix.
+     */
+    MatrixChanges(unsigned int rows, unsigned int cols) { clear(rows, cols); };
+
+    /**
+     * @brief Mark the row and the column of a single changed cell.
+     * @param row The row of the cell.
+     * @param col The column of the cell.
+     */
+    void mark(unsigned int row, unsigned int col)
+    {
+        if (!_all)
+        {
+            _changedRows[row] = true;
+            _changedCols[col] = true;
+        }
+    };
+
+    /**
+     * @brief Mark all the rows and columns as changed.
+     */
+    void markAll() { _all = true; };
+
+    /**
+     * @brief Clear the changes, for a Matrix of the given dimensions.
+     * @param rows The number of rows in the Matrix.
+     * @param cols The number of columns in the Matrix.
+     */
+    void clear(unsigned int rows, unsigned int cols)
+    {
+        _changedRows.assign(rows, false);
+        _changedCols.assign(cols, false);
+        _all = false;
+    };
+
+    /**
+     * @brief Returns the changed rows, in increasing order.
+     * @param count The number of rows in the Matrix.
+     * @return The changed rows.
+     */
+    std::vector<unsigned int> rows(unsigned int count) const
+    {
+        return _changed(_changedRows, count);
+    };
+
+    /**
+     * @brief Returns the changed columns, in increasing order.
+     * @param count The number of columns in the Matrix.
+     * @return The changed columns.
+     */
+    std::vector<unsigned int> cols(unsigned int count) const
+    {
+        return _changed(_changedCols, count);
+    };
+
+private:
+
+    /**
+     * @brief A flag for each row which determine if it was changed.
+     */
+    std::vector<unsigned char> _changedRows;
+
+    /**
+     * @brief A flag for each column which determine if it was changed.
+     */
+    std::vector<unsigned char> _changedCols;
+
+    /**
+     * @brief A flag which determine if all the rows and columns were changed.
+     */
+    bool _all;
+
+    /**
+     * @brief Returns the changed lines of the given flags, in increasing order.
+     * @param flags The flag of each line.
+     * @param count The number of lines in the Matrix.
+     * @return The changed lines.
+     */
+    std::vector<unsigned int> _changed(const std::vector<unsigned char>& flags,
+                                       unsigned int count) const
+    {
+        std::vector<unsigned int> lines;
+        for (unsigned int line = 0; line < count; line++)
+        {
+            if (_all || (line < flags.size() && flags[line]))
+            {
+                lines.push_back(line);
+            }
+        }
+        return lines;
+    };
+};
+
+#endif
@@ -0,0 +1,205 @@
+/**
+ * @file MatrixThreadPool.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 18 Oct 2026
+ *
+ * @brief A Header File for the Matrix Thread Pool Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the Matrix Thread Pool Class.
+ * The Matrix Thread Pool is a fixed set of worker threads which is shared by the whole program
+ * and performs the asynchronous Matrix operations. The workers are created on the first use and
+ * live until the end of the program, so submitting a task doesn't create a thread.
+ */
+
+
+#ifndef _MATRIXTHREADPOOL_H
+#define _MATRIXTHREADPOOL_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def DEFAULT_POOL_SIZE 1
+ * @brief A Macro that sets the number of worker threads in the pool if the number of cores is
+ *        unknown.
+ */
+#define DEFAULT_POOL_SIZE 1
+
+
+/*-----=  Class Definition  =-----*/
+
+
+/**
+ * @brief A Class representing a pool of worker threads which perform submitted tasks in the
+ *        order of their submission. The tasks must not wait for other tasks of the pool.
+ */
+class MatrixThreadPool
+{
+public:
+
+    /**
+     * @brief Returns the pool which is shared by all the Matrix operations, with one worker
+     *        per core.
+     * @return The shared pool.
+     */
+    static MatrixThreadPool& shared()
+    {
+        static MatrixThreadPool pool;
+        return pool;
+    };
+
+    /**
+     * @brief The Destructor for the pool, which performs the remaining tasks and then joins
+     *        the workers.
+     */
+    ~MatrixThreadPool();
+
+    /**
+     * @brief Returns the number of worker threads in the pool.
+     * @return The number of worker threads in the pool.
+     */
+    unsigned int size() const { return (unsigned int) _workers.size(); };
+
+    /**
+     * @brief Submit a task to be performed by one of the workers.
+     * @param task The task to perform.
+     */
+    void submit(std::function<void()> task);
+
+private:
+
+    /**
+     * @brief The worker threads of the pool.
+     */
+    std::vector<std::thread> _workers;
+
+    /**
+     * @brief The tasks which were submitted and not yet taken by a worker.
+     */
+    std::deque<std::function<void()>> _tasks;
+
+    /**
+     * @brief A mutex which guards the tasks queue.
+     */
+    std::mutex _mutex;
+
+    /**
+     * @brief A condition which is notified when a task is submitted or the pool is stopping.
+     */
+    std::condition_variable _taskAvailable;
+
+    /**
+     * @brief A flag which determine if the pool is stopping.
+     */
+    bool _stopping;
+
+    /**
+     * @brief The Constructor starts one worker per core.
+     */
+    MatrixThreadPool();
+
+    /**
+     * @brief A pool owns it's workers, so it cannot be copied.
+     */
+    MatrixThreadPool(const MatrixThreadPool& other) = delete;
+
+    /**
+     * @brief A pool owns it's workers, so it cannot be assigned.
+     */
+    MatrixThreadPool& operator=(const MatrixThreadPool& other) = delete;
+
+    /**
+     * @brief The loop of a worker thread, which performs the submitted tasks until the pool is
+     *        stopping and there are no remaining tasks.
+     */
+    void _work();
+};
+
+
+/*-----=  Implementation  =-----*/
+
+
+/**
+ * @brief The Constructor starts one worker per core.
+ */
+inline MatrixThreadPool::MatrixThreadPool() : _stopping(false)
+{
+    unsigned int cores = std::thread::hardware_concurrency();
+    unsigned int workers = (cores == 0) ? DEFAULT_POOL_SIZE : cores;
+    for (unsigned int worker = 0; worker < workers; worker++)
+    {
+        _workers.push_back(std::thread(&MatrixThreadPool::_work, this));
+    }
+}
+
+/**
+ * @brief The Destructor for the pool, which performs the remaining tasks and then joins
+ *        the workers.
+ */
+inline MatrixThreadPool::~MatrixThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _taskAvailable.notify_all();
+    for (std::thread& worker : _workers)
+    {
+        worker.join();
+    }
+}
+
+/**
+ * @brief Submit a task to be performed by one of the workers.
+ * @param task The task to perform.
+ */
+inline void MatrixThreadPool::submit(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _tasks.push_back(std::move(task));
+    }
+    _taskAvailable.notify_one();
+}
+
+/**
+ * @brief The loop of a worker thread, which performs the submitted tasks until the pool is
+ *        stopping and there are no remaining tasks.
+ */
+inline void MatrixThreadPool::_work()
+{
+    while (true)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _taskAvailable.wait(lock, [this]() { return _stopping || !_tasks.empty(); });
+            if (_tasks.empty())
+            {
+                return;
+            }
+            task = std::move(_tasks.front());
+            _tasks.pop_front();
+        }
+        task();
+    }
+}
+
+#endif
@@ -0,0 +1,378 @@
+/**
+ * @file MatrixTopology.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 18 Oct 2026
+ *
+ * @brief A Header File for the Matrix Topology Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the Matrix Topology Class.
+ * The Matrix Topology describes the NUMA nodes of the machine and the cores of each node, as
+ * reported by the operating system and limited to the cores which the process may run on (e.g.
+ * by taskset or a cpuset), and is used by the Matrix parallel mode to place it's worker threads.
+ * The workers are assigned to the cores node after node, so the contiguous blocks of rows which
+ * the workers process (and first touch) are spread evenly over the nodes.
+ * On systems which don't report their topology, a single node with all the allowed cores is
+ * assumed.
+ */
+
+
+#ifndef _MATRIXTOPOLOGY_H
+#define _MATRIXTOPOLOGY_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <string>
+#include <vector>
+#include <sstream>
+#include <fstream>
+#include <thread>
+#include <memory>
+#include <utility>
+#include <algorithm>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def NODE_ONLINE "/sys/devices/system/node/online"
+ * @brief A Macro that sets the system file which lists the online NUMA nodes.
+ */
+#define NODE_ONLINE "/sys/devices/system/node/online"
+
+/**
+ * @def NODE_DIRECTORY "/sys/devices/system/node/node"
+ * @brief A Macro that sets the prefix of the system directory which describes a NUMA node.
+ */
+#define NODE_DIRECTORY "/sys/devices/system/node/node"
+
+/**
+ * @def NODE_CPU_LIST "/cpulist"
+ * @brief A Macro that sets the file (in the node directory) which lists the cores of the node.
+ */
+#define NODE_CPU_LIST "/cpulist"
+
+/**
+ * @def CPU_LIST_SEPARATOR ','
+ * @brief A Macro that sets the separator between the ranges in a list of cores.
+ */
+#define CPU_LIST_SEPARATOR ','
+
+/**
+ * @def CPU_RANGE_SEPARATOR '-'
+ * @brief A Macro that sets the separator between the first and the last core in a range.
+ */
+#define CPU_RANGE_SEPARATOR '-'
+
+
+/*-----=  Class Definition  =-----*/
+
+
+/**
+ * @brief A Class representing the NUMA topology of the machine.
+ *        The topology is discovered once, on the first access.
+ */
+class MatrixTopology
+{
+public:
+
+    /**
+     * @brief Returns the topology of this machine.
+     * @return The topology of this machine.
+     */
+    static const MatrixTopology& system()
+    {
+        static const MatrixTopology topology;
+        return topology;
+    };
+
+    /**
+     * @brief Returns the number of NUMA nodes.
+     * @return The number of NUMA nodes.
+     */
+    unsigned int nodesCount() const { return (unsigned int) _nodeCpus.size(); };
+
+    /**
+     * @brief Returns the cores of the given NUMA node.
+     * @param node The NUMA node.
+     * @return The cores of the given NUMA node.
+     */
+    const std::vector<unsigned int>& nodeCpus(unsigned int node) const
+    {
+        return _nodeCpus[node];
+    };
+
+    /**
+     * @brief Returns all the cores, ordered node after node. Worker i of the parallel mode
+     *        runs on core (i % cores count) of this order.
+     * @return All the cores, ordered by their nodes.
+     */
+    const std::vector<unsigned int>& workerCpus() const { return _workerCpus; };
+
+    /**
+     * @brief Returns the NUMA node of the given core.
+     * @param cpu The core.
+     * @return The NUMA node of the given core.
+     */
+    unsigned int nodeOf(unsigned int cpu) const;
+
+    /**
+     * @brief Pin the calling thread to the given core.
+     *        On systems which don't support it, nothing is done.
+     * @param cpu The core to pin the calling thread to.
+     * @return true if the thread was pinned, false otherwise.
+     */
+    static bool pinCurrentThread(unsigned int cpu);
+
+private:
+
+    /**
+     * @brief The cores of each NUMA node.
+     */
+    std::vector<std::vector<unsigned int>> _nodeCpus;
+
+    /**
+     * @brief All the cores, ordered node after node.
+     */
+    std::vector<unsigned int> _workerCpus;
+
+    /**
+     * @brief The Constructor discovers the topology of the machine.
+     */
+    MatrixTopology();
+
+    /**
+     * @brief Parse a list of cores in the system format (e.g. "0-3,8,10-11"). The online nodes
+     *        are listed in the same format.
+     * @param list The list of cores.
+     * @return The cores in the list.
+     */
+    static std::vector<unsigned int> _parseCpuList(const std::string& list);
+
+    /**
+     * @brief Returns the cores which the process may run on, in ascending order.
+     *        On systems which don't report it, an empty list is returned.
+     * @return The cores which the process may run on.
+     */
+    static std::vector<unsigned int> _allowedCpus();
+};
+
+
+/**
+ * @brief An Allocator for the Matrix cells which default-initializes the cells instead of
+ *        value-initializing them. For plain element types (e.g. int and double) the memory is
+ *        therefore not touched on allocation, and each page is placed on the NUMA node of the
+ *        thread which first writes to it.
+ */
+template <class T>
+class FirstTouchAllocator : public std::allocator<T>
+{
+public:
+
+    /**
+     * @brief Rebinds the Allocator to another element type.
+     */
+    template <class U>
+    struct rebind
+    {
+        typedef FirstTouchAllocator<U> other;
+    };
+
+    /**
+     * @brief The Default Constructor for the Allocator.
+     */
+    FirstTouchAllocator() { };
+
+    /**
+     * @brief A Copy Constructor from an Allocator of another element type.
+     */
+    template <class U>
+    FirstTouchAllocator(const FirstTouchAllocator<U>&) { };
+
+    /**
+     * @brief Default-initialize an element in the given memory.
+     * @param pointer The memory of the element.
+     */
+    template <class U>
+    void construct(U *pointer) { ::new((void *) pointer) U; };
+
+    /**
+     * @brief Construct an element in the given memory from the given arguments.
+     * @param pointer The memory of the element.
+     * @param args The arguments of the element Constructor.
+     */
+    template <class U, class... Args>
+    void construct(U *pointer, Args&&... args)
+    {
+        ::new((void *) pointer) U(std::forward<Args>(args)...);
+    };
+};
+
+
+/*-----=  Implementation  =-----*/
+
+
+/**
+ * @brief The Constructor discovers the topology of the machine.
+ */
+inline MatrixTopology::MatrixTopology()
+{
+    const std::vector<unsigned int> allowed = _allowedCpus();
+
+    // The online nodes may have gaps in their numbers, and a node without allowed cores is
+    // left out.
+    std::ifstream onlineList(NODE_ONLINE);
+    std::string nodes;
+    if (onlineList.is_open() && std::getline(onlineList, nodes))
+    {
+        for (unsigned int node : _parseCpuList(nodes))
+        {
+            std::ifstream cpuList(NODE_DIRECTORY + std::to_string(node) + NODE_CPU_LIST);
+            std::string list;
+            if (!cpuList.is_open() || !std::getline(cpuList, list))
+            {
+                continue;
+            }
+            std::vector<unsigned int> cpus;
+            for (unsigned int cpu : _parseCpuList(list))
+            {
+                if (allowed.empty() || std::binary_search(allowed.begin(), allowed.end(), cpu))
+                {
+                    cpus.push_back(cpu);
+                }
+            }
+            if (!cpus.empty())
+            {
+                _nodeCpus.push_back(cpus);
+            }
+        }
+    }
+
+    if (_nodeCpus.empty())
+    {
+        std::vector<unsigned int> cpus = allowed;
+        for (unsigned int cpu = 0; allowed.empty() && cpu < std::thread::hardware_concurrency();
+             cpu++)
+        {
+            cpus.push_back(cpu);
+        }
+        if (cpus.empty())
+        {
+            cpus.push_back(0);
+        }
+        _nodeCpus.push_back(cpus);
+    }
+
+    for (const std::vector<unsigned int>& cpus : _nodeCpus)
+    {
+        _workerCpus.insert(_workerCpus.end(), cpus.begin(), cpus.end());
+    }
+}
+
+/**
+ * @brief Parse a list of cores in the system format (e.g. "0-3,8,10-11").
+ * @param list The list of cores.
+ * @return The cores in the list.
+ */
+inline std::vector<unsigned int> MatrixTopology::_parseCpuList(const std::string& list)
+{
+    std::vector<unsigned int> cpus;
+    std::stringstream stream(list);
+    std::string range;
+    while (std::getline(stream, range, CPU_LIST_SEPARATOR))
+    {
+        if (range.empty())
+        {
+            continue;
+        }
+        std::string::size_type separator = range.find(CPU_RANGE_SEPARATOR);
+        unsigned int first = (unsigned int) std::stoul(range.substr(0, separator));
+        unsigned int last = first;
+        if (separator != std::string::npos)
+        {
+            last = (unsigned int) std::stoul(range.substr(separator + 1));
+        }
+        for (unsigned int cpu = first; cpu <= last; cpu++)
+        {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+/**
+ * @brief Returns the cores which the process may run on, in ascending order.
+ *        On systems which don't report it, an empty list is returned.
+ * @return The cores which the process may run on.
+ */
+inline std::vector<unsigned int> MatrixTopology::_allowedCpus()
+{
+    std::vector<unsigned int> cpus;
+#ifdef __linux__
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    if (sched_getaffinity(0, sizeof(cpuSet), &cpuSet) == 0)
+    {
+        for (unsigned int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+        {
+            if (CPU_ISSET(cpu, &cpuSet))
+            {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+#endif
+    return cpus;
+}
+
+/**
+ * @brief Returns the NUMA node of the given core.
+ * @param cpu The core.
+ * @return The NUMA node of the given core.
+ */
+inline unsigned int MatrixTopology::nodeOf(unsigned int cpu) const
+{
+    for (unsigned int node = 0; node < _nodeCpus.size(); node++)
+    {
+        for (unsigned int nodeCpu : _nodeCpus[node])
+        {
+            if (nodeCpu == cpu)
+            {
+                return node;
+            }
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Pin the calling thread to the given core.
+ *        On systems which don't support it, nothing is done.
+ * @param cpu The core to pin the calling thread to.
+ * @return true if the thread was pinned, false otherwise.
+ */
+inline bool MatrixTopology::pinCurrentThread(unsigned int cpu)
+{
+#ifdef __linux__
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(cpu, &cpuSet);
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) == 0;
+#else
+    (void) cpu;
+    return false;
+#endif
+}
+
+#endif
@@ -0,0 +1,219 @@
+/**
+ * @file ScalarTraits.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 18 Oct 2026
+ *
+ * @brief A File which contains the Scalar Traits used by the Matrix Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File which contains the Scalar Traits used by the Matrix Class.
+ * The Scalar Traits describe the numeric properties of a Matrix element type
+ * (e.g. magnitude, squared magnitude and conjugate), so the Matrix operations which need them
+ * (norms, pivoting, Hermitian operations...) can be written once for every element type.
+ * The generic version fits all the real arithmetic types, and Complex has it's own specialization.
+ */
+
+
+#ifndef _SCALARTRAITS_H
+#define _SCALARTRAITS_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include "Complex.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def HASH_MULTIPLIER 0x100000001b3ULL
+ * @brief A Macro that sets the odd multiplier which mixes the parts of a hash (the 64 bits
+ *        FNV prime).
+ */
+#define HASH_MULTIPLIER 0x100000001b3ULL
+
+
+/*-----=  Class Definition  =-----*/
+
+
+/**
+ * @brief A Traits Class describing the numeric properties of a real Matrix element type.
+ */
+template <class T>
+struct ScalarTraits
+{
+    /**
+     * @brief Returns the magnitude (absolute value) of the given element.
+     * @param value The element to measure.
+     * @return The magnitude of the given element.
+     */
+    static double abs(const T& value) { return std::fabs(static_cast<double>(value)); };
+
+    /**
+     * @brief Returns the squared magnitude of the given element.
+     * @param value The element to measure.
+     * @return The squared magnitude of the given element.
+     */
+    static double norm(const T& value)
+    {
+        double real = static_cast<double>(value);
+        return real * real;
+    };
+
+    /**
+     * @brief Returns the conjugate of the given element, which for real elements is the
+     *        element itself.
+     * @param value The element to conjugate.
+     * @return The conjugate of the given element.
+     */
+    static T conj(const T& value) { return value; };
+
+    /**
+     * @brief Returns the real part of the given element, which for real elements is the
+     *        element itself.
+     * @param value The element to take the real part of.
+     * @return The real part of the given element.
+     */
+    static double real(const T& value) { return static_cast<double>(value); };
+
+    /**
+     * @brief Returns the quotient of the given elements.
+     * @param numerator The element to divide.
+     * @param denominator The element to divide by.
+     * @return The quotient of the given elements.
+     */
+    static T divide(const T& numerator, const T& denominator) { return numerator / denominator; };
+
+    /**
+     * @brief Determine if the equality operator of the element type is exact, so equal
+     *        elements always have the same hash.
+     */
+    static const bool exactEquality = true;
+
+    /**
+     * @brief Determine if the element type is a floating point type. The division of integers
+     *        truncates, so only floating point elements may be decomposed.
+     */
+    static const bool floating = std::is_floating_point<T>::value;
+
+    /**
+     * @brief Determine if the element type has a hash, so Matrices of it have checksums. Only
+     *        the arithmetic types have one, and other element types are compared cell by cell.
+     */
+    static const bool hashable = std::is_arithmetic<T>::value;
+
+    /**
+     * @brief Returns a hash of the given element, which is the same for equal elements
+     *        (including 0.0 and -0.0). It is defined only for hashable element types.
+     * @param value The element to hash.
+     * @return The hash of the given element.
+     */
+    static std::uint64_t hash(const T& value) { return std::hash<T>()(value); };
+};
+
+
+/**
+ * @brief A Traits Class describing the numeric properties of a Complex Matrix element.
+ */
+template <>
+struct ScalarTraits<Complex>
+{
+    /**
+     * @brief Returns the magnitude (absolute value) of the given Complex number.
+     * @param value The Complex number to measure.
+     * @return The magnitude of the given Complex number.
+     */
+    static double abs(const Complex& value)
+    {
+        return std::hypot(value.getReal(), value.getImaginary());
+    };
+
+    /**
+     * @brief Returns the squared magnitude of the given Complex number.
+     * @param value The Complex number to measure.
+     * @return The squared magnitude of the given Complex number.
+     */
+    static double norm(const Complex& value)
+    {
+        return (value.getReal() * value.getReal()) +
+               (value.getImaginary() * value.getImaginary());
+    };
+
+    /**
+     * @brief Returns the conjugate of the given Complex number.
+     * @param value The Complex number to conjugate.
+     * @return The conjugate of the given Complex number.
+     */
+    static Complex conj(const Complex& value) { return value.conj(); };
+
+    /**
+     * @brief Returns the real part of the given Complex number.
+     * @param value The Complex number to take the real part of.
+     * @return The real part of the given Complex number.
+     */
+    static double real(const Complex& value) { return value.getReal(); };
+
+    /**
+     * @brief Returns the quotient of the given Complex numbers.
+     *        The numerator is multiplied by the conjugate of the denominator, and the result is
+     *        scaled by the squared magnitude of the denominator.
+     * @param numerator The Complex number to divide.
+     * @param denominator The Complex number to divide by.
+     * @return The quotient of the given Complex numbers.
+     */
+    static Complex divide(const Complex& numerator, const Complex& denominator)
+    {
+        Complex product = numerator * denominator.conj();
+        double scale = norm(denominator);
+        return Complex(product.getReal() / scale, product.getImaginary() / scale);
+    };
+
+    /**
+     * @brief Determine if the equality operator of the element type is exact. Complex numbers
+     *        are compared with a tolerance, so close numbers may have different hashes.
+     */
+    static const bool exactEquality = false;
+
+    /**
+     * @brief Determine if the element type is a floating point type, which Complex numbers are.
+     */
+    static const bool floating = true;
+
+    /**
+     * @brief Determine if the element type has a hash, which Complex numbers have.
+     */
+    static const bool hashable = true;
+
+    /**
+     * @brief Returns a hash of the given Complex number, which is the same for numbers with
+     *        the same parts.
+     * @param value The Complex number to hash.
+     * @return The hash of the given Complex number.
+     */
+    static std::uint64_t hash(const Complex& value)
+    {
+        std::hash<double> hasher;
+        return (hasher(value.getReal()) * HASH_MULTIPLIER) ^ hasher(value.getImaginary());
+    };
+};
+
+
+/**
+ * @brief The given result type of an operation which exists only for floating point elements
+ *        (e.g. the determinant), so the operation is rejected at compile time for integers.
+ */
+template <class T, class Result>
+using FloatingResult = typename std::enable_if<ScalarTraits<T>::floating, Result>::type;
+
+
+#endif
@@ -0,0 +1,395 @@
+/**
+ * @file StructuredMatrix.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 18 Oct 2026
+ *
+ * @brief A Header File for the Structured Matrix Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the Structured Matrix Class.
+ * A Structured Matrix is a square Matrix whose non-zero cells are known to lie in a band around
+ * the diagonal (a diagonal, triangular or banded Matrix), or whose upper triangle mirrors it's
+ * lower triangle (a symmetric or Hermitian Matrix). Only the cells which may be non-zero (the
+ * lower triangle for a symmetric or Hermitian Matrix) are stored, row by row, so a diagonal
+ * Matrix keeps n cells, a triangular Matrix keeps n * (n + 1) / 2 cells and a banded Matrix
+ * keeps about n * (lower + upper + 1) cells.
+ * The operations visit only the stored cells, so a product of a Structured Matrix and a dense
+ * Matrix with c columns takes O(stored * c) instead of O(n^2 * c).
+ * Like the Matrix Class, this .h file includes it's .hpp file because this is a Template Class.
+ */
+
+
+#ifndef _STRUCTUREDMATRIX_H
+#define _STRUCTUREDMATRIX_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <vector>
+#include <algorithm>
+#include "Matrix.h"
+
+
+/*-----=  Enums Definition  =-----*/
+
+
+/**
+ * @brief The structure of a Structured Matrix.
+ */
+enum MatrixStructure
+{
+    /**
+     * @brief Only the diagonal may be non-zero.
+     */
+    DIAGONAL,
+
+    /**
+     * @brief Only the diagonal and the cells below it may be non-zero.
+     */
+    LOWER_TRIANGULAR,
+
+    /**
+     * @brief Only the diagonal and the cells above it may be non-zero.
+     */
+    UPPER_TRIANGULAR,
+
+    /**
+     * @brief Cell (i, j) equals cell (j, i), so only the lower triangle is stored.
+     */
+    SYMMETRIC,
+
+    /**
+     * @brief Cell (i, j) equals the conjugate of cell (j, i), so only the lower triangle is
+     *        stored. For elements which are not Complex, it is the same as SYMMETRIC.
+     */
+    HERMITIAN,
+
+    /**
+     * @brief Only the cells up to a given distance below and above the diagonal may be
+     *        non-zero.
+     */
+    BANDED
+};
+
+
+/*-----=  Class Definition  =-----*/
+
+
+/**
+ * @brief A Class representing a square Matrix with a known structure, which stores only the
+ *        cells that the structure doesn't determine.
+ *        The operations support the multithread mode of the Matrix, where each thread perform
+ *        the operation of a block of rows. For int elements the operations are not checked for
+ *        an overflow.
+ */
+template <class T>
+class StructuredMatrix
+{
+public:
+
+    /**
+     * @brief A Constructor for a Structured Matrix of the given structure and size, whose cells
+     *        are all set to DEFAULT_VALUE.
+     *        If the size is invalid (i.e. equals to zero), an Exception will be thrown.
+     * @param structure The structure of the Matrix.
+     * @param size The number of rows and columns in the Matrix.
+     * @param lower The number of diagonals below the main diagonal of a BANDED Matrix.
+     * @param upper The number of diagonals above the main diagonal of a BANDED Matrix.
+     */
+    StructuredMatrix(MatrixStructure structure, unsigned int size, unsigned int lower = 0,
+                     unsigned int upper = 0);
+
+    /**
+     * @brief A Constructor for a Structured Matrix of the given structure, which takes the cells
+     *        of the given Matrix that the structure stores. The other cells of the Matrix are
+     *        ignored (e.g. the upper triangle of a SYMMETRIC Matrix).
+     *        If the Matrix is not square, or if it is HERMITIAN and it's diagonal is not real,
+     *        an Exception will be thrown.
+     * @param matrix The Matrix to take the cells from.
+     * @param structure The structure of the Matrix.
+     * @param lower The number of diagonals below the main diagonal of a BANDED Matrix.
+     * @param upper The number of diagonals above the main diagonal of a BANDED Matrix.
+     */
+    StructuredMatrix(const Matrix<T>& matrix, MatrixStructure structure, unsigned int lower = 0,
+                     unsigned int upper = 0);
+
+    /**
+     * @brief Returns the structure of the Matrix.
+     * @return The structure of the Matrix.
+     */
+    MatrixStructure structure() const { return _structure; };
+
+    /**
+     * @brief Returns the number of rows in the Matrix.
+     * @return The number of rows in the Matrix.
+     */
+    unsigned int rows() const { return _size; };
+
+    /**
+     * @brief Returns the number of columns in the Matrix.
+     * @return The number of columns in the Matrix.
+     */
+    unsigned int cols() const { return _size; };
+
+    /**
+     * @brief Returns the number of diagonals below the main diagonal which may be non-zero.
+     * @return The lower bandwidth of the Matrix.
+     */
+    unsigned int lowerBandwidth() const { return _lower; };
+
+    /**
+     * @brief Returns the number of diagonals above the main diagonal which may be non-zero.
+     * @return The upper bandwidth of the Matrix.
+     */
+    unsigned int upperBandwidth() const { return _isMirrored() ? _lower : _upper; };
+
+    /**
+     * @brief Returns the number of cells which are stored.
+     * @return The number of stored cells.
+     */
+    std::size_t storedCells() const { return _cells.size(); };
+
+    /**
+     * @brief An operator overload for the operator '()' for reading a cell of the Matrix.
+     *        If the indices are invalid, an Exception will be thrown.
+     * @param row The row of the cell.
+     * @param col The column of the cell.
+     * @return The value of the cell.
+     */
+    T operator()(unsigned int row, unsigned int col) const;
+
+    /**
+     * @brief Sets a cell of the Matrix which the structure doesn't determine. Setting a cell of
+     *        the upper triangle of a SYMMETRIC or HERMITIAN Matrix sets it's mirror (to the
+     *        conjugate of the value for a HERMITIAN Matrix).
+     *        There is no operator '()' which gives access to a cell, since most of the cells
+     *        of a Structured Matrix are not stored.
+     *        If the indices are invalid or the cell is determined by the structure (e.g. it is
+     *        outside of the band), an Exception will be thrown. A diagonal cell of a HERMITIAN
+     *        Matrix must be real, otherwise an Exception will be thrown.
+     * @param row The row of the cell.
+     * @param col The column of the cell.
+     * @param value The value of the cell.
+     */
+    void set(unsigned int row, unsigned int col, const T& value);
+
+    /**
+     * @brief Returns a dense Matrix with the cells of this Matrix.
+     * @return A dense Matrix with the cells of this Matrix.
+     */
+    Matrix<T> toMatrix() const;
+
+    /**
+     * @brief An operator overload for the addition operator '+'.
+     *        The result has the narrowest structure which holds both Matrices (e.g. the sum of
+     *        a LOWER_TRIANGULAR and an UPPER_TRIANGULAR Matrix is BANDED).
+     *        If the sizes of the Matrices doesn't fit, an Exception will be thrown.
+     * @param other The other Matrix to add to this Matrix.
+     * @return A Structured Matrix which represent the result of the addition operation.
+     */
+    StructuredMatrix<T> operator+(const StructuredMatrix<T>& other) const;
+
+    /**
+     * @brief An operator overload for the multiplication operator '*'.
+     *        The bandwidths of the result are the sums of the bandwidths of the Matrices (e.g.
+     *        the product of two LOWER_TRIANGULAR Matrices is LOWER_TRIANGULAR).
+     *        If the sizes of the Matrices doesn't fit, an Exception will be thrown.
+     * @param other The other Matrix to multiply to this Matrix.
+     * @return A Structured Matrix which represent the result of the multiplication operation.
+     */
+    StructuredMatrix<T> operator*(const StructuredMatrix<T>& other) const;
+
+    /**
+     * @brief An operator overload for the addition operator '+' with a dense Matrix.
+     *        If the dimensions of the Matrices doesn't fit, an Exception will be thrown.
+     * @param other The dense Matrix to add to this Matrix.
+     * @return A Matrix which represent the result of the addition operation.
+     */
+    Matrix<T> operator+(const Matrix<T>& other) const;
+
+    /**
+     * @brief An operator overload for the multiplication operator '*' with a dense Matrix.
+     *        If the dimensions of the Matrices doesn't fit, an Exception will be thrown.
+     * @param other The dense Matrix to multiply to this Matrix (on the right side).
+     * @return A Matrix which represent the result of the multiplication operation.
+     */
+    Matrix<T> operator*(const Matrix<T>& other) const;
+
+    /**
+     * @brief Perform the Transpose operation on this Matrix, which is the conjugate transpose
+     *        for Complex elements (like the Transpose of a Matrix). The Transpose of a HERMITIAN
+     *        Matrix is the same Matrix.
+     * @return A Structured Matrix which represent the result of the Transpose operation.
+     */
+    StructuredMatrix<T> trans() const;
+
+private:
+
+    /**
+     * @brief The product of a dense Matrix and a Structured Matrix works on the cells of the
+     *        Structured Matrix directly.
+     */
+    template <class U>
+    friend Matrix<U> operator*(const Matrix<U>& first, const StructuredMatrix<U>& second);
+
+    /**
+     * @brief The structure of the Matrix.
+     */
+    MatrixStructure _structure;
+
+    /**
+     * @brief The number of rows and columns in the Matrix.
+     */
+    unsigned int _size;
+
+    /**
+     * @brief The number of stored diagonals below the main diagonal.
+     */
+    unsigned int _lower;
+
+    /**
+     * @brief The number of stored diagonals above the main diagonal.
+     */
+    unsigned int _upper;
+
+    /**
+     * @brief The stored cells, row by row.
+     */
+    std::vector<T> _cells;
+
+    /**
+     * @brief The index in the stored cells of the first stored cell of each row, followed by
+     *        the number of stored cells.
+     */
+    std::vector<std::size_t> _offsets;
+
+    /**
+     * @brief Determine if the upper triangle of the Matrix mirrors it's lower triangle.
+     * @return true if the Matrix is SYMMETRIC or HERMITIAN, false otherwise.
+     */
+    bool _isMirrored() const { return _structure == SYMMETRIC || _structure == HERMITIAN; };
+
+    /**
+     * @brief Determine if the given stored cell may hold the given value. A diagonal cell of a
+     *        HERMITIAN Matrix equals it's own conjugate, so it must be real.
+     * @param row The row of the cell.
+     * @param col The column of the cell.
+     * @param value The value of the cell.
+     * @return true if the cell may hold the value, false otherwise.
+     */
+    bool _fits(unsigned int row, unsigned int col, const T& value) const
+    {
+        return _structure != HERMITIAN || row != col || ScalarTraits<T>::conj(value) == value;
+    };
+
+    /**
+     * @brief Returns the first stored column of the given row.
+     * @param row The row.
+     * @return The first stored column of the row.
+     */
+    unsigned int _first(unsigned int row) const { return row - std::min(row, _lower); };
+
+    /**
+     * @brief Returns the column after the last stored column of the given row.
+     * @param row The row.
+     * @return The column after the last stored column of the row.
+     */
+    unsigned int _end(unsigned int row) const { return std::min(_size, row + _upper + 1); };
+
+    /**
+     * @brief Returns the column after the last column of the given row which may be non-zero
+     *        (the first column which may be non-zero is the first stored column).
+     * @param row The row.
+     * @return The column after the last column of the row which may be non-zero.
+     */
+    unsigned int _nonZeroEnd(unsigned int row) const
+    {
+        return std::min(_size, row + upperBandwidth() + 1);
+    };
+
+    /**
+     * @brief Returns a reference to the given stored cell.
+     * @param row The row of the cell.
+     * @param col The column of the cell, which must be stored in the row.
+     * @return A reference to the cell.
+     */
+    T& _stored(unsigned int row, unsigned int col)
+    {
+        return _cells[_offsets[row] + (col - _first(row))];
+    };
+
+    const T& _stored(unsigned int row, unsigned int col) const
+    {
+        return _cells[_offsets[row] + (col - _first(row))];
+    };
+
+    /**
+     * @brief Returns the value of the given cell, without checking the indices.
+     * @param row The row of the cell.
+     * @param col The column of the cell.
+     * @return The value of the cell.
+     */
+    T _value(unsigned int row, unsigned int col) const;
+
+    /**
+     * @brief Set each stored cell to the value which the given function returns for it's
+     *        indices. The rows are set in parallel in the multithread mode of the Matrix.
+     * @param value The function which receives the row and the column of a cell, and returns
+     *        it's value.
+     */
+    template <class Function>
+    void _fill(Function value);
+
+    /**
+     * @brief Returns the product of the given dense Matrix and this Matrix.
+     *        If the dimensions of the Matrices doesn't fit, an Exception will be thrown.
+     * @param first The dense Matrix in the multiplication operation (on the left side).
+     * @return A Matrix which represent the result of the multiplication operation.
+     */
+    Matrix<T> _multiplyLeft(const Matrix<T>& first) const;
+
+    /**
+     * @brief Returns the narrowest structure which holds the given bandwidths.
+     * @param size The number of rows and columns in the Matrix.
+     * @param lower The number of diagonals below the main diagonal.
+     * @param upper The number of diagonals above the main diagonal.
+     * @return The structure.
+     */
+    static MatrixStructure _classify(unsigned int size, unsigned int lower, unsigned int upper);
+};
+
+
+/*-----=  Non-Member Operators  =-----*/
+
+
+/**
+ * @brief An operator overload for the addition operator '+' of a dense Matrix and a Structured
+ *        Matrix.
+ *        If the dimensions of the Matrices doesn't fit, an Exception will be thrown.
+ * @param first The dense Matrix in the addition operation (on the left side).
+ * @param second The Structured Matrix in the addition operation (on the right side).
+ * @return A Matrix which represent the result of the addition operation.
+ */
+template <class T>
+Matrix<T> operator+(const Matrix<T>& first, const StructuredMatrix<T>& second);
+
+/**
+ * @brief An operator overload for the multiplication operator '*' of a dense Matrix and a
+ *        Structured Matrix.
+ *        If the dimensions of the Matrices doesn't fit, an Exception will be thrown.
+ * @param first The dense Matrix in the multiplication operation (on the left side).
+ * @param second The Structured Matrix in the multiplication operation (on the right side).
+ * @return A Matrix which represent the result of the multiplication operation.
+ */
+template <class T>
+Matrix<T> operator*(const Matrix<T>& first, const StructuredMatrix<T>& second);
+
+
+#include "StructuredMatrix.hpp"
+
+#endif
@@ -0,0 +1,527 @@
+/**
+ * @file StructuredMatrix.hpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 18 Oct 2026
+ *
+ * @brief An implementation of the Structured Matrix Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * An implementation of the Structured Matrix Class.
+ * The stored cells of row i are the columns [i - lower, i + upper] which are in the Matrix, so
+ * every structure is kept as a band: a diagonal Matrix has no diagonals beside the main one, a
+ * lower triangular Matrix has n - 1 lower diagonals, and so on. The kernels walk the columns of
+ * each row which may be non-zero, so they are shared by all the structures.
+ */
+
+
+#ifndef _STRUCTUREDMATRIX_HPP
+#define _STRUCTUREDMATRIX_HPP
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <cassert>
+#include "StructuredMatrix.h"
+#include "ScalarTraits.h"
+
+
+/*-----=  Constructors  =-----*/
+
+
+/**
+ * @brief A Constructor for a Structured Matrix of the given structure and size, whose cells are
+ *        all set to DEFAULT_VALUE.
+ *        If the size is invalid (i.e. equals to zero), an Exception will be thrown.
+ * @param structure The structure of the Matrix.
+ * @param size The number of rows and columns in the Matrix.
+ * @param lower The number of diagonals below the main diagonal of a BANDED Matrix.
+ * @param upper The number of diagonals above the main diagonal of a BANDED Matrix.
+ */
+template <class T>
+StructuredMatrix<T>::StructuredMatrix(MatrixStructure structure, unsigned int size,
+                                      unsigned int lower, unsigned int upper)
+        : _structure(structure), _size(size), _lower(0), _upper(0), _offsets(size + 1)
+{
+    if (size == 0)
+    {
+        throw MatrixDimensionsException();
+    }
+
+    const unsigned int widest = size - 1;
+    switch (structure)
+    {
+        case LOWER_TRIANGULAR:
+        case SYMMETRIC:
+        case HERMITIAN:
+            _lower = widest;
+            break;
+        case UPPER_TRIANGULAR:
+            _upper = widest;
+            break;
+        case BANDED:
+            _lower = std::min(lower, widest);
+            _upper = std::min(upper, widest);
+            break;
+        default:
+            break;
+    }
+
+    _offsets[0] = 0;
+    for (unsigned int row = 0; row < _size; row++)
+    {
+        _offsets[row + 1] = _offsets[row] + (_end(row) - _first(row));
+    }
+    _cells.assign(_offsets[_size], T(DEFAULT_VALUE));
+}
+
+/**
+ * @brief A Constructor for a Structured Matrix of the given structure, which takes the cells of
+ *        the given Matrix that the structure stores. The other cells of the Matrix are ignored
+ *        (e.g. the upper triangle of a SYMMETRIC Matrix).
+ *        If the Matrix is not square, or if it is HERMITIAN and it's diagonal is not real, an
+ *        Exception will be thrown.
+ * @param matrix The Matrix to take the cells from.
+ * @param structure The structure of the Matrix.
+ * @param lower The number of diagonals below the main diagonal of a BANDED Matrix.
+ * @param upper The number of diagonals above the main diagonal of a BANDED Matrix.
+ */
+template <class T>
+StructuredMatrix<T>::StructuredMatrix(const Matrix<T>& matrix, MatrixStructure structure,
+                                      unsigned int lower, unsigned int upper)
+        : StructuredMatrix(structure, matrix.rows(), lower, upper)
+{
+    if (matrix.rows() != matrix.cols())
+    {
+        throw MatrixDimensionsException();
+    }
+    for (unsigned int i = 0; i < _size; i++)
+    {
+        if (!_fits(i, i, matrix._cell(i, i)))
+        {
+            throw MatrixStructureException();
+        }
+    }
+
+    _fill([&](unsigned int row, unsigned int col) -> T
+    {
+        return matrix._cell(row, col);
+    });
+}
+
+
+/*-----=  Cell Access  =-----*/
+
+
+/**
+ * @brief An operator overload for the operator '()' for reading a cell of the Matrix.
+ *        If the indices are invalid, an Exception will be thrown.
+ * @param row The row of the cell.
+ * @param col The column of the cell.
+ * @return The value of the cell.
+ */
+template <class T>
+T StructuredMatrix<T>::operator()(unsigned int row, unsigned int col) const
+{
+    if (row >= _size || col >= _size)
+    {
+        throw MatrixIndexException();
+    }
+    return _value(row, col);
+}
+
+/**
+ * @brief Sets a cell of the Matrix which the structure doesn't determine. Setting a cell of the
+ *        upper triangle of a SYMMETRIC or HERMITIAN Matrix sets it's mirror (to the conjugate
+ *        of the value for a HERMITIAN Matrix).
+ *        If the indices are invalid or the cell is determined by the structure (e.g. it is
+ *        outside of the band), an Exception will be thrown. A diagonal cell of a HERMITIAN
+ *        Matrix must be real, otherwise an Exception will be thrown.
+ * @param row The row of the cell.
+ * @param col The column of the cell.
+ * @param value The value of the cell.
+ */
+template <class T>
+void StructuredMatrix<T>::set(unsigned int row, unsigned int col, const T& value)
+{
+    if (_isMirrored() && col > row)
+    {
+        set(col, row, (_structure == HERMITIAN) ? ScalarTraits<T>::conj(value) : value);
+        return;
+    }
+    if (row >= _size || col < _first(row) || col >= _end(row))
+    {
+        throw MatrixIndexException();
+    }
+    if (!_fits(row, col, value))
+    {
+        throw MatrixStructureException();
+    }
+    _stored(row, col) = value;
+}
+
+/**
+ * @brief Returns the value of the given cell, without checking the indices.
+ * @param row The row of the cell.
+ * @param col The column of the cell.
+ * @return The value of the cell.
+ */
+template <class T>
+T StructuredMatrix<T>::_value(unsigned int row, unsigned int col) const
+{
+    if (_isMirrored() && col > row)
+    {
+        const T& mirror = _stored(col, row);
+        return (_structure == HERMITIAN) ? ScalarTraits<T>::conj(mirror) : mirror;
+    }
+    if (col < _first(row) || col >= _end(row))
+    {
+        return T(DEFAULT_VALUE);
+    }
+    return _stored(row, col);
+}
+
+/**
+ * @brief Returns a dense Matrix with the cells of this Matrix.
+ * @return A dense Matrix with the cells of this Matrix.
+ */
+template <class T>
+Matrix<T> StructuredMatrix<T>::toMatrix() const
+{
+    Matrix<T> result(_size, _size);
+    Matrix<T>::_parallelFor(_size, [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int row = begin; row < end; row++)
+        {
+            for (unsigned int col = _first(row); col < _nonZeroEnd(row); col++)
+            {
+                result._cell(row, col) = _value(row, col);
+            }
+        }
+    });
+    result._invalidateChecksum();
+    return result;
+}
+
+
+/*-----=  Operators  =-----*/
+
+
+/**
+ * @brief An operator overload for the addition operator '+'.
+ *        The result has the narrowest structure which holds both Matrices (e.g. the sum of a
+ *        LOWER_TRIANGULAR and an UPPER_TRIANGULAR Matrix is BANDED). Matrices of the same
+ *        structure are added cell by cell on their stored cells.
+ *        If the sizes of the Matrices doesn't fit, an Exception will be thrown.
+ * @param other The other Matrix to add to this Matrix.
+ * @return A Structured Matrix which represent the result of the addition operation.
+ */
+template <class T>
+StructuredMatrix<T> StructuredMatrix<T>::operator+(const StructuredMatrix<T>& other) const
+{
+    // If the two Matrices dimensions does not fit for this operation.
+    if (_size != other._size)
+    {
+        throw MatrixDimensionsException();
+    }
+
+    if (_structure == other._structure && _lower == other._lower && _upper == other._upper)
+    {
+        StructuredMatrix<T> result(*this);
+        for (std::size_t i = 0; i < _cells.size(); i++)
+        {
+            result._cells[i] += other._cells[i];
+        }
+        return result;
+    }
+
+    // A diagonal added to a symmetric Matrix keeps it symmetric, and otherwise the sum holds
+    // the bands of both Matrices.
+    MatrixStructure structure = SYMMETRIC;
+    if (!((_structure == SYMMETRIC && other._structure == DIAGONAL) ||
+          (_structure == DIAGONAL && other._structure == SYMMETRIC)))
+    {
+        structure = _classify(_size, std::max(lowerBandwidth(), other.lowerBandwidth()),
+                              std::max(upperBandwidth(), other.upperBandwidth()));
+    }
+    StructuredMatrix<T> result(structure, _size,
+                               std::max(lowerBandwidth(), other.lowerBandwidth()),
+                               std::max(upperBandwidth(), other.upperBandwidth()));
+    result._fill([&](unsigned int row, unsigned int col) -> T
+    {
+        return _value(row, col) + other._value(row, col);
+    });
+    return result;
+}
+
+/**
+ * @brief An operator overload for the multiplication operator '*'.
+ *        The bandwidths of the result are the sums of the bandwidths of the Matrices (e.g. the
+ *        product of two LOWER_TRIANGULAR Matrices is LOWER_TRIANGULAR), and each row of the
+ *        result visits only the columns of this Matrix and the rows of the other Matrix which
+ *        may be non-zero.
+ *        If the sizes of the Matrices doesn't fit, an Exception will be thrown.
+ * @param other The other Matrix to multiply to this Matrix.
+ * @return A Structured Matrix which represent the result of the multiplication operation.
+ */
+template <class T>
+StructuredMatrix<T> StructuredMatrix<T>::operator*(const StructuredMatrix<T>& other) const
+{
+    // If the two Matrices dimensions does not fit for this operation.
+    if (_size != other._size)
+    {
+        throw MatrixDimensionsException();
+    }
+
+    const unsigned int widest = _size - 1;
+    const unsigned int lower = std::min(widest, lowerBandwidth() + other.lowerBandwidth());
+    const unsigned int upper = std::min(widest, upperBandwidth() + other.upperBandwidth());
+    StructuredMatrix<T> result(_classify(_size, lower, upper), _size, lower, upper);
+    Matrix<T>::_parallelFor(_size, [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int row = begin; row < end; row++)
+        {
+            for (unsigned int k = _first(row); k < _nonZeroEnd(row); k++)
+            {
+                const T scale = _value(row, k);
+                for (unsigned int col = other._first(k); col < other._nonZeroEnd(k); col++)
+                {
+                    assert(col >= result._first(row) && col < result._end(row));
+                    result._stored(row, col) += scale * other._value(k, col);
+                }
+            }
+        }
+    });
+    return result;
+}
+
+/**
+ * @brief An operator overload for the addition operator '+' with a dense Matrix.
+ *        If the dimensions of the Matrices doesn't fit, an Exception will be thrown.
+ * @param other The dense Matrix to add to this Matrix.
+ * @return A Matrix which represent the result of the addition operation.
+ */
+template <class T>
+Matrix<T> StructuredMatrix<T>::operator+(const Matrix<T>& other) const
+{
+    // If the two Matrices dimensions does not fit for this operation.
+    if (_size != other.rows() || _size != other.cols())
+    {
+        throw MatrixDimensionsException();
+    }
+
+    Matrix<T> result(other);
+    result._detach();
+    Matrix<T>::_parallelFor(_size, [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int row = begin; row < end; row++)
+        {
+            for (unsigned int col = _first(row); col < _nonZeroEnd(row); col++)
+            {
+                result._cell(row, col) += _value(row, col);
+            }
+        }
+    });
+    result._invalidateChecksum();
+    return result;
+}
+
+/**
+ * @brief An operator overload for the multiplication operator '*' with a dense Matrix.
+ *        Each row of the result is the sum of the rows of the dense Matrix which match the
+ *        columns of the row of this Matrix that may be non-zero.
+ *        If the dimensions of the Matrices doesn't fit, an Exception will be thrown.
+ * @param other The dense Matrix to multiply to this Matrix (on the right side).
+ * @return A Matrix which represent the result of the multiplication operation.
+ */
+template <class T>
+Matrix<T> StructuredMatrix<T>::operator*(const Matrix<T>& other) const
+{
+    // If the two Matrices dimensions does not fit for this operation.
+    if (_size != other.rows())
+    {
+        throw MatrixDimensionsException();
+    }
+
+    const unsigned int cols = other.cols();
+    Matrix<T> result(_size, cols);
+    Matrix<T>::_parallelFor(_size, [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int row = begin; row < end; row++)
+        {
+            for (unsigned int k = _first(row); k < _nonZeroEnd(row); k++)
+            {
+                const T scale = _value(row, k);
+                for (unsigned int col = 0; col < cols; col++)
+                {
+                    result._cell(row, col) += scale * other._cell(k, col);
+                }
+            }
+        }
+    });
+    result._invalidateChecksum();
+    return result;
+}
+
+/**
+ * @brief Perform the Transpose operation on this Matrix, which is the conjugate transpose for
+ *        Complex elements (like the Transpose of a Matrix). The Transpose of a HERMITIAN Matrix
+ *        is the same Matrix, and the Transpose of a diagonal or SYMMETRIC Matrix keeps it's
+ *        cells in place.
+ * @return A Structured Matrix which represent the result of the Transpose operation.
+ */
+template <class T>
+StructuredMatrix<T> StructuredMatrix<T>::trans() const
+{
+    if (_structure == HERMITIAN)
+    {
+        return *this;
+    }
+    if (_structure == DIAGONAL || _structure == SYMMETRIC)
+    {
+        StructuredMatrix<T> result(*this);
+        for (T& cell : result._cells)
+        {
+            cell = ScalarTraits<T>::conj(cell);
+        }
+        return result;
+    }
+
+    MatrixStructure structure = _structure;
+    if (_structure == LOWER_TRIANGULAR)
+    {
+        structure = UPPER_TRIANGULAR;
+    }
+    else if (_structure == UPPER_TRIANGULAR)
+    {
+        structure = LOWER_TRIANGULAR;
+    }
+    StructuredMatrix<T> result(structure, _size, _upper, _lower);
+    result._fill([&](unsigned int row, unsigned int col) -> T
+    {
+        return ScalarTraits<T>::conj(_stored(col, row));
+    });
+    return result;
+}
+
+/**
+ * @brief An operator overload for the addition operator '+' of a dense Matrix and a Structured
+ *        Matrix.
+ *        If the dimensions of the Matrices doesn't fit, an Exception will be thrown.
+ * @param first The dense Matrix in the addition operation (on the left side).
+ * @param second The Structured Matrix in the addition operation (on the right side).
+ * @return A Matrix which represent the result of the addition operation.
+ */
+template <class T>
+Matrix<T> operator+(const Matrix<T>& first, const StructuredMatrix<T>& second)
+{
+    return second + first;
+}
+
+/**
+ * @brief An operator overload for the multiplication operator '*' of a dense Matrix and a
+ *        Structured Matrix.
+ *        If the dimensions of the Matrices doesn't fit, an Exception will be thrown.
+ * @param first The dense Matrix in the multiplication operation (on the left side).
+ * @param second The Structured Matrix in the multiplication operation (on the right side).
+ * @return A Matrix which represent the result of the multiplication operation.
+ */
+template <class T>
+Matrix<T> operator*(const Matrix<T>& first, const StructuredMatrix<T>& second)
+{
+    return second._multiplyLeft(first);
+}
+
+/**
+ * @brief Returns the product of the given dense Matrix and this Matrix. Each row of the result
+ *        adds each cell of the row of the dense Matrix times the cells of the matching row of
+ *        this Matrix which may be non-zero.
+ *        If the dimensions of the Matrices doesn't fit, an Exception will be thrown.
+ * @param first The dense Matrix in the multiplication operation (on the left side).
+ * @return A Matrix which represent the result of the multiplication operation.
+ */
+template <class T>
+Matrix<T> StructuredMatrix<T>::_multiplyLeft(const Matrix<T>& first) const
+{
+    // If the two Matrices dimensions does not fit for this operation.
+    if (first.cols() != _size)
+    {
+        throw MatrixDimensionsException();
+    }
+
+    Matrix<T> result(first.rows(), _size);
+    Matrix<T>::_parallelFor(first.rows(), [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int row = begin; row < end; row++)
+        {
+            for (unsigned int k = 0; k < _size; k++)
+            {
+                const T& scale = first._cell(row, k);
+                for (unsigned int col = _first(k); col < _nonZeroEnd(k); col++)
+                {
+                    result._cell(row, col) += scale * _value(k, col);
+                }
+            }
+        }
+    });
+    result._invalidateChecksum();
+    return result;
+}
+
+
+/*-----=  Structure Helpers  =-----*/
+
+
+/**
+ * @brief Set each stored cell to the value which the given function returns for it's indices.
+ *        The rows are set in parallel in the multithread mode of the Matrix.
+ * @param value The function which receives the row and the column of a cell, and returns it's
+ *        value.
+ */
+template <class T>
+template <class Function>
+void StructuredMatrix<T>::_fill(Function value)
+{
+    Matrix<T>::_parallelFor(_size, [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int row = begin; row < end; row++)
+        {
+            for (unsigned int col = _first(row); col < _end(row); col++)
+            {
+                _stored(row, col) = value(row, col);
+            }
+        }
+    });
+}
+
+/**
+ * @brief Returns the narrowest structure which holds the given bandwidths.
+ * @param size The number of rows and columns in the Matrix.
+ * @param lower The number of diagonals below the main diagonal.
+ * @param upper The number of diagonals above the main diagonal.
+ * @return The structure.
+ */
+template <class T>
+MatrixStructure StructuredMatrix<T>::_classify(unsigned int size, unsigned int lower,
+                                               unsigned int upper)
+{
+    if (lower == 0 && upper == 0)
+    {
+        return DIAGONAL;
+    }
+    if (upper == 0 && lower == size - 1)
+    {
+        return LOWER_TRIANGULAR;
+    }
+    if (lower == 0 && upper == size - 1)
+    {
+        return UPPER_TRIANGULAR;
+    }
+    return BANDED;
+}
+
+#endif
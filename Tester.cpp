@@ -1,5 +1,95 @@
 #include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <climits>
+#include <cmath>
 #include "Matrix.h"
+#include "StructuredMatrix.h"
+#include "MatrixExpr.h"
+#include "TiledMatrix.h"
+
+// A custom element type (the integers modulo 7), which has no std::hash.
+struct Mod7
+{
+    int value;
+
+    Mod7(int number = 0) : value(((number % 7) + 7) % 7) { }
+
+    Mod7 operator+(const Mod7& other) const { return Mod7(value + other.value); }
+    Mod7 operator-(const Mod7& other) const { return Mod7(value - other.value); }
+    Mod7 operator*(const Mod7& other) const { return Mod7(value * other.value); }
+    Mod7& operator+=(const Mod7& other) { return *this = *this + other; }
+    Mod7& operator-=(const Mod7& other) { return *this = *this - other; }
+    bool operator==(const Mod7& other) const { return value == other.value; }
+    bool operator!=(const Mod7& other) const { return value != other.value; }
+};
+
+std::ostream& operator<<(std::ostream& out, const Mod7& number)
+{
+    return out << number.value;
+}
+
+// Determine if a Matrix of the given elements has a determinant (which needs exact division).
+template <class T>
+auto hasDeterminant(int) -> decltype(std::declval<const Matrix<T>&>().det(), bool())
+{
+    return true;
+}
+
+template <class T>
+bool hasDeterminant(long)
+{
+    return false;
+}
+
+// Determine if a Matrix of the given elements has an exponential.
+template <class T>
+auto hasExponential(int) -> decltype(matrixExp(std::declval<const Matrix<T>&>()), bool())
+{
+    return true;
+}
+
+template <class T>
+bool hasExponential(long)
+{
+    return false;
+}
+
+// Creates a Matrix of the given dimensions whose cells are small integers without a simple
+// pattern, plus the given value on the diagonal.
+template <class T>
+Matrix<T> patternMatrix(unsigned int rows, unsigned int cols, int diagonal = 0)
+{
+    std::vector<T> cells;
+    for (unsigned int i = 0; i < rows * cols; i++)
+    {
+        const int value = (int) ((i * 37) % 19) - 9;
+        cells.push_back(T(value + ((i / cols == i % cols) ? diagonal : 0)));
+    }
+    return Matrix<T>(rows, cols, cells);
+}
+
+// Returns the output of the batch mode of the driver for the given jobs, or an empty string if
+// the driver can't be run (it is expected in the current directory).
+std::string runDriverBatch(const std::string& jobs)
+{
+    const char *path = "TesterBatch.txt";
+    std::ofstream(path) << jobs;
+    std::string output;
+    FILE *driver = popen("./GenericMatrixDriver --batch TesterBatch.txt 2>/dev/null", "r");
+    if (driver != nullptr)
+    {
+        char buffer[256];
+        while (std::fgets(buffer, sizeof(buffer), driver) != nullptr)
+        {
+            output += buffer;
+        }
+        pclose(driver);
+    }
+    std::remove(path);
+    return output;
+}
 
 int main()
 {
@@ -108,6 +198,230 @@ int main()
         std::cout << "Attempt to perform multiplication between the transpose and the original (4x3 with 3x4)..." << std::endl;
         std::cout << (matrixInt3 * matrixInt3.trans()) << std::endl;
 
+        std::cout << "----------------------------------------------------------------------\n" << std::endl;
+
+        // Checking the determinant and the inverse of a Matrix of doubles (should be 1).
+        std::cout << "Creating a new Matrix of doubles of size 2x2 with a given cells..." << std::endl;
+        std::vector<double> vecDouble1 = {2, 1, 1, 1};
+        Matrix<double> matrixDouble1(2, 2, vecDouble1);
+        std::cout << matrixDouble1 << std::endl;
+        std::cout << "Get the determinant: ";
+        std::cout << matrixDouble1.det() << std::endl;
+        std::cout << "Check if the product with the inverse is the identity: ";
+        std::cout << std::boolalpha
+                  << (matrixDouble1 * matrixDouble1.inverse()).approxEqual(Matrix<double>::identity(2), 1e-12, 1e-12)
+                  << std::endl;
+
+        // Checking that a Matrix of ints has no determinant (should be false).
+        std::cout << "Check if a Matrix of ints has a determinant: ";
+        std::cout << std::boolalpha << hasDeterminant<int>(0) << std::endl;
+
+        // Checking that a Matrix of ints has no exponential (should be false).
+        std::cout << "Check if a Matrix of ints has an exponential: ";
+        std::cout << std::boolalpha << hasExponential<int>(0) << std::endl;
+        std::cout << "Check if a Matrix of doubles has an exponential: ";
+        std::cout << std::boolalpha << hasExponential<double>(0) << std::endl;
+
+        std::cout << "----------------------------------------------------------------------\n" << std::endl;
+
+        // Checking a Matrix of a custom element type (compared cell by cell, without checksums).
+        std::cout << "Creating a new Matrix of integers modulo 7 of size 2x2 with a given cells..." << std::endl;
+        std::vector<Mod7> vecMod1 = {1, 2, 3, 4};
+        Matrix<Mod7> matrixMod1(2, 2, vecMod1);
+        std::cout << matrixMod1 << std::endl;
+        std::cout << "Attempt to perform multiplication of this Matrix with itself..." << std::endl;
+        Matrix<Mod7>::setChecksumCache(true);
+        Matrix<Mod7>::setResultCache(true);
+        Matrix<Mod7> matrixMod2 = matrixMod1 * matrixMod1;
+        std::cout << matrixMod2 << std::endl;
+        // Checking the equality operator (should be false, and then true).
+        std::cout << "Check equality with the product and original: ";
+        std::cout << std::boolalpha << (matrixMod2 == matrixMod1) << std::endl;
+        std::cout << "Check equality with the product and a new product: ";
+        std::cout << std::boolalpha << (matrixMod2 == matrixMod1 * matrixMod1) << std::endl;
+
+        std::cout << "----------------------------------------------------------------------\n" << std::endl;
+
+        // Checking the decompositions by reconstructing the decomposed Matrices (should be true).
+        std::cout << "Creating a new Matrix of doubles of size 100x100 and a positive definite Matrix from it..." << std::endl;
+        Matrix<double> matrixDouble2 = patternMatrix<double>(100, 100, 50);
+        Matrix<double> matrixPositive = matrixDouble2 * matrixDouble2.trans();
+        std::cout << "Check if the Cholesky factors reconstruct the positive definite Matrix: ";
+        CholeskyDecomposition<double> cholesky(matrixPositive);
+        std::cout << std::boolalpha
+                  << (cholesky.lower() * cholesky.lower().trans()).approxEqual(matrixPositive, 1e-12, 1e-9) << std::endl;
+        std::cout << "Check if the QR factors reconstruct the Matrix: ";
+        QRDecomposition<double> qr(matrixDouble2);
+        std::cout << std::boolalpha << (qr.q() * qr.r()).approxEqual(matrixDouble2, 1e-12, 1e-9) << std::endl;
+
+        // Checking the power and the exponential (should be true).
+        std::cout << "Check if the 10th power of the Fibonacci Matrix holds the 11th Fibonacci number: ";
+        Matrix<int> matrixFibonacci(2, 2, std::vector<int>{1, 1, 1, 0});
+        std::cout << std::boolalpha << (pow(matrixFibonacci, 10)(0, 0) == 89) << std::endl;
+        std::cout << "Check if the 5th power equals the product of 5 copies: ";
+        Matrix<int> matrixInt5 = patternMatrix<int>(4, 4);
+        std::cout << std::boolalpha
+                  << (pow(matrixInt5, 5) == matrixInt5 * matrixInt5 * matrixInt5 * matrixInt5 * matrixInt5) << std::endl;
+        std::cout << "Check if the exponential of a diagonal Matrix is the exponential of it's diagonal: ";
+        Matrix<double> matrixExponential = matrixExp(Matrix<double>(2, 2, std::vector<double>{1, 0, 0, -2}));
+        std::cout << std::boolalpha
+                  << matrixExponential.approxEqual(Matrix<double>(2, 2, std::vector<double>{std::exp(1.0), 0, 0, std::exp(-2.0)}), 1e-12, 1e-14)
+                  << std::endl;
+
+        std::cout << "----------------------------------------------------------------------\n" << std::endl;
+
+        // Checking the Structured Matrices against the dense Matrices (should be true).
+        std::cout << "Creating a lower triangular and a banded Matrix of ints of size 6x6..." << std::endl;
+        Matrix<int> matrixInt6 = patternMatrix<int>(6, 6);
+        StructuredMatrix<int> lowerTriangular(matrixInt6, LOWER_TRIANGULAR);
+        StructuredMatrix<int> banded(matrixInt6.trans(), BANDED, 1, 2);
+        std::cout << banded.toMatrix() << std::endl;
+        std::cout << "Check if their product equals the product of the dense Matrices: ";
+        std::cout << std::boolalpha
+                  << ((lowerTriangular * banded).toMatrix() == lowerTriangular.toMatrix() * banded.toMatrix()) << std::endl;
+        std::cout << "Check if their sum equals the sum of the dense Matrices: ";
+        std::cout << std::boolalpha
+                  << ((lowerTriangular + banded).toMatrix() == lowerTriangular.toMatrix() + banded.toMatrix()) << std::endl;
+        std::cout << "Check if the product with a dense Matrix equals the dense product: ";
+        std::cout << std::boolalpha << (banded * matrixInt6 == banded.toMatrix() * matrixInt6) << std::endl;
+        std::cout << "Check if a symmetric Matrix equals it's Transpose: ";
+        Matrix<int> matrixSymmetric = StructuredMatrix<int>(matrixInt6, SYMMETRIC).toMatrix();
+        std::cout << std::boolalpha << (matrixSymmetric == matrixSymmetric.trans()) << std::endl;
+
+        std::cout << "----------------------------------------------------------------------\n" << std::endl;
+
+        // Checking the lazy expressions (should be true).
+        std::cout << "Building the expression (A^T * B) + (A^T * B) * C of ints..." << std::endl;
+        Matrix<int> matrixA = patternMatrix<int>(30, 2);
+        Matrix<int> matrixB = patternMatrix<int>(30, 40);
+        Matrix<int> matrixC = patternMatrix<int>(40, 40);
+        MatrixExprGraph<int> graph;
+        MatrixExpr<int> exprA = graph.input(matrixA);
+        MatrixExpr<int> exprB = graph.input(matrixB);
+        MatrixExpr<int> exprC = graph.input(matrixC);
+        MatrixExpr<int> expr = (exprA.trans() * exprB) + (exprA.trans() * exprB) * exprC;
+        std::cout << "Check if the repeated subexpression is kept once (7 nodes): ";
+        std::cout << std::boolalpha << (graph.size() == 7) << std::endl;
+        std::cout << "Check if the reordered chain gives the same result: ";
+        std::cout << std::boolalpha
+                  << (graph.evaluate(expr) == matrixA.trans() * matrixB + matrixA.trans() * matrixB * matrixC) << std::endl;
+
+        // Checking the incremental product (should be true).
+        std::cout << "Check if the incremental product equals the full product after changes: ";
+        MatrixProduct<int> product(matrixB, matrixC);
+        matrixB(3, 7) = 100;
+        matrixC(5, 1) = -100;
+        matrixC(9, 9) = 7;
+        std::cout << std::boolalpha << (product.update() == matrixB * matrixC) << std::endl;
+
+        std::cout << "----------------------------------------------------------------------\n" << std::endl;
+
+        // Checking the result cache statistics (should be true).
+        std::cout << "Multiplying the same Matrices of ints twice with the result cache..." << std::endl;
+        Matrix<int>::setResultCache(true);
+        MatrixCache<int>& cache = MatrixCache<int>::shared();
+        MatrixCacheStats statsBefore = cache.stats();
+        Matrix<int> cachedProduct = matrixB * matrixC;
+        std::cout << "Check if the first product missed and the second hit: ";
+        std::cout << std::boolalpha
+                  << (cachedProduct == matrixB * matrixC && cache.stats().misses == statsBefore.misses + 1 &&
+                      cache.stats().hits == statsBefore.hits + 1) << std::endl;
+        std::cout << "Check if a cache of a single result evicts it for a new one: ";
+        cache.setCapacity(matrixC.rows() * matrixC.cols() * sizeof(int));
+        statsBefore = cache.stats();
+        Matrix<int> evictingProduct = matrixC * matrixC;
+        std::cout << std::boolalpha
+                  << (cache.stats().evictions == statsBefore.evictions + 1 && cache.stats().entries == 1) << std::endl;
+        cache.setCapacity(DEFAULT_CACHE_CAPACITY);
+        Matrix<int>::setResultCache(false);
+
+        // Checking the Gauss multiplication of Complex numbers (should be true).
+        std::cout << "Check if the Gauss multiplication of Complex numbers equals the normal product: ";
+        std::vector<Complex> vecComplex;
+        for (unsigned int i = 0; i < 40 * 40; i++)
+        {
+            vecComplex.push_back(Complex((int) (i % 13) - 6, (int) (i % 7) - 3));
+        }
+        Matrix<Complex> matrixComplex(40, 40, vecComplex);
+        Matrix<Complex> normalProduct = matrixComplex * matrixComplex.trans();
+        Matrix<Complex>::setGaussMultiplication(true);
+        std::cout << std::boolalpha
+                  << (matrixComplex * matrixComplex.trans()).approxEqual(normalProduct, 1e-12, 1e-9) << std::endl;
+        Matrix<Complex>::setGaussMultiplication(false);
+
+        std::cout << "----------------------------------------------------------------------\n" << std::endl;
+
+        // Checking the Tiled Matrix round trips (should be true).
+        std::cout << "Storing a Matrix of doubles of size 70x50 in tiles of 16x16..." << std::endl;
+        Matrix<double> matrixDouble3 = patternMatrix<double>(70, 50);
+        {
+            TiledMatrix<double> tiled("TesterTiled1.bin", 70, 50, 16);
+            TiledMatrix<double> tiledTrans("TesterTiled2.bin", 50, 70, 16);
+            TiledMatrix<double> tiledProduct("TesterTiled3.bin", 70, 70, 16);
+            tiled.load(matrixDouble3);
+            std::cout << "Check if the Matrix is read back: ";
+            std::cout << std::boolalpha << (tiled.toMatrix() == matrixDouble3) << std::endl;
+            std::cout << "Check if the tile (1, 2) holds the cells of it's block: ";
+            std::cout << std::boolalpha << (tiled.readTile(1, 2)(3, 1) == matrixDouble3(16 + 3, 32 + 1)) << std::endl;
+            std::cout << "Check if the tiled Transpose and product equal the in-memory ones: ";
+            TiledMatrix<double>::trans(tiled, tiledTrans);
+            TiledMatrix<double>::multiply(tiled, tiledTrans, tiledProduct);
+            std::cout << std::boolalpha
+                      << (tiledTrans.toMatrix() == matrixDouble3.trans() &&
+                          tiledProduct.toMatrix().approxEqual(matrixDouble3 * matrixDouble3.trans(), 1e-12, 1e-9))
+                      << std::endl;
+        }
+        std::remove("TesterTiled1.bin");
+        std::remove("TesterTiled2.bin");
+        std::remove("TesterTiled3.bin");
+
+        // Checking the batch mode of the driver (should be true when the driver is built).
+        std::cout << "Check if the batch mode of the driver prints the results in the order of the jobs: ";
+        std::ostringstream expected;
+        expected << "job 1: int *\n" << Matrix<int>(2, 2, std::vector<int>{19, 22, 43, 50})
+                 << "job 2: double trans\n" << Matrix<double>(3, 2, std::vector<double>{1, 4, 2, 5, 3, 6});
+        std::cout << std::boolalpha
+                  << (runDriverBatch("int *\n2 2\n1,2,\n3,4,\n2 2\n5,6,\n7,8,\n\n"
+                                     "double trans\n2 3\n1,2,3,\n4,5,6,\n") == expected.str())
+                  << std::endl;
+
+        std::cout << "----------------------------------------------------------------------\n" << std::endl;
+
+        // Regression: the decompositions are exact in mixed precision mode, and they don't fill
+        // the result cache (should be true).
+        std::cout << "Check if the inverse is accurate in mixed precision mode: ";
+        Matrix<double>::setMixedPrecision(true);
+        Matrix<double>::setResultCache(true);
+        const MatrixCacheStats doubleStats = MatrixCache<double>::shared().stats();
+        Matrix<double> inverse = matrixDouble2.inverse();
+        const bool cacheUnchanged = MatrixCache<double>::shared().stats().misses == doubleStats.misses;
+        Matrix<double>::setResultCache(false);
+        Matrix<double>::setMixedPrecision(false);
+        std::cout << std::boolalpha
+                  << (matrixDouble2 * inverse).approxEqual(Matrix<double>::identity(100), 1e-12, 1e-12) << std::endl;
+        std::cout << "Check if the decomposition didn't use the result cache: ";
+        std::cout << std::boolalpha << cacheUnchanged << std::endl;
+
+        // Regression: a sum of ints which wraps around 64 bits is an overflow.
+        try
+        {
+            std::cout << "Attempt to multiply 4 cells of INT_MIN by 4 cells of INT_MIN (2^64 wraps to 0)..." << std::endl;
+            Matrix<int> matrixMin(1, 4, std::vector<int>{INT_MIN, INT_MIN, INT_MIN, INT_MIN});
+            std::cout << (matrixMin * matrixMin.trans()) << std::endl;
+        }
+        catch (MatrixException& e)
+        {
+            std::cout << "An Exception caught: " << e.what() << std::endl;
+        }
+
+        // Regression: a reference taken before a Transpose doesn't change it (should be true).
+        std::cout << "Check if a reference taken before a Transpose doesn't change the Transpose: ";
+        int& cell = matrixInt5(0, 1);
+        Matrix<int> matrixInt5Trans = matrixInt5.trans();
+        const int previousCell = cell;
+        cell = previousCell + 1;
+        std::cout << std::boolalpha << (matrixInt5Trans(1, 0) == previousCell) << std::endl;
+
         std::cout << "------------------------------- END ----------------------------------\n" << std::endl;
 
     }
@@ -0,0 +1,275 @@
+/**
+ * @file TiledMatrix.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 18 Oct 2026
+ *
+ * @brief A Header File for the Tiled Matrix Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the Tiled Matrix Class.
+ * Declaring the Tiled Matrix Class, it's methods and fields.
+ * A Tiled Matrix is a Matrix which is stored in a file on the disk, as square tiles of a fixed
+ * size, so it may be larger than the physical memory.
+ * The Tiled Matrix operations stream the tiles through the in-memory Matrix operations, while
+ * the next tiles are read (and the previous results are written) in the background, so only a
+ * few tiles are held in memory at any time.
+ * The tiles are stored as the raw bytes of the elements, so the element type must be a plain
+ * data type (e.g. int, double or Complex).
+ */
+
+
+#ifndef _TILEDMATRIX_H
+#define _TILEDMATRIX_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <mutex>
+#include "Matrix.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def TILE_SIZE 256
+ * @brief A Macro that sets the default number of rows (and columns) in a single tile.
+ */
+#define TILE_SIZE 256
+
+
+/*-----=  Class Definition  =-----*/
+
+
+/**
+ * @brief A Class representing a Matrix which is stored in a file as square tiles.
+ *        The file is created by the Constructor, and all the cells are initially zero.
+ *        A Tiled Matrix cannot be copied, because it owns it's file.
+ */
+template <class T>
+class TiledMatrix
+{
+public:
+
+    /**
+     * @brief A Constructor for a Tiled Matrix which receives the path of it's file and the
+     *        desired dimensions, and creates the file (an existing file is truncated).
+     *        If one of the dimensions is invalid, or the tile size is zero, an Exception will
+     *        be thrown. If the file cannot be created, an Exception will be thrown.
+     * @param path The path of the file which stores the Matrix.
+     * @param rows The number of rows in the Matrix.
+     * @param cols The number of columns in the Matrix.
+     * @param tileSize The number of rows (and columns) in a single tile.
+     */
+    TiledMatrix(const std::string& path, unsigned int rows, unsigned int cols,
+                unsigned int tileSize = TILE_SIZE);
+
+    /**
+     * @brief The Destructor for the Tiled Matrix, which closes it's file (but keeps it).
+     */
+    ~TiledMatrix();
+
+    /**
+     * @brief Returns the number of rows in the Matrix.
+     * @return The number of rows in the Matrix.
+     */
+    unsigned int rows() const { return _rows; };
+
+    /**
+     * @brief Returns the number of columns in the Matrix.
+     * @return The number of columns in the Matrix.
+     */
+    unsigned int cols() const { return _cols; };
+
+    /**
+     * @brief Returns the number of rows (and columns) in a single tile.
+     * @return The number of rows in a single tile.
+     */
+    unsigned int tileSize() const { return _tileSize; };
+
+    /**
+     * @brief Returns the number of tiles in each column of tiles.
+     * @return The number of tiles in each column of tiles.
+     */
+    unsigned int tileRows() const { return _tileRows; };
+
+    /**
+     * @brief Returns the number of tiles in each row of tiles.
+     * @return The number of tiles in each row of tiles.
+     */
+    unsigned int tileCols() const { return _tileCols; };
+
+    /**
+     * @brief Read a single tile from the file.
+     *        The tiles on the last row and column of tiles may be smaller than the tile size.
+     *        If the tile indices are invalid, an Exception will be thrown.
+     * @param tileRow The row of the tile.
+     * @param tileCol The column of the tile.
+     * @return A Matrix which holds the tile.
+     */
+    Matrix<T> readTile(unsigned int tileRow, unsigned int tileCol) const;
+
+    /**
+     * @brief Write a single tile to the file.
+     *        If the tile indices are invalid or if the given Matrix doesn't fit the tile
+     *        dimensions, an Exception will be thrown.
+     * @param tileRow The row of the tile.
+     * @param tileCol The column of the tile.
+     * @param tile The Matrix to write to the tile.
+     */
+    void writeTile(unsigned int tileRow, unsigned int tileCol, const Matrix<T>& tile);
+
+    /**
+     * @brief Write a single row of the Matrix to the file, so a Matrix can be streamed into the
+     *        file row by row without holding it in memory.
+     *        If the row is invalid or the number of given cells doesn't fit the Matrix columns,
+     *        an Exception will be thrown.
+     * @param row The row to write.
+     * @param cells The cells of the row.
+     */
+    void writeRow(unsigned int row, const std::vector<T>& cells);
+
+    /**
+     * @brief Write the given in-memory Matrix to the file.
+     *        If the dimensions of the given Matrix doesn't fit, an Exception will be thrown.
+     * @param matrix The Matrix to write.
+     */
+    void load(const Matrix<T>& matrix);
+
+    /**
+     * @brief Read the whole Matrix from the file into memory.
+     * @return An in-memory Matrix with the same data.
+     */
+    Matrix<T> toMatrix() const;
+
+    /**
+     * @brief Add the two given Tiled Matrices into the given result Tiled Matrix, tile by tile.
+     *        If the dimensions or the tile sizes doesn't fit, an Exception will be thrown.
+     * @param first The first Matrix to add.
+     * @param second The second Matrix to add.
+     * @param result The Matrix which holds the result of the addition operation.
+     */
+    static void add(const TiledMatrix<T>& first, const TiledMatrix<T>& second,
+                    TiledMatrix<T>& result);
+
+    /**
+     * @brief Multiply the two given Tiled Matrices into the given result Tiled Matrix.
+     *        Each result tile is accumulated from the products of a row of tiles of the first
+     *        Matrix with a column of tiles of the second Matrix.
+     *        If the dimensions or the tile sizes doesn't fit, an Exception will be thrown.
+     * @param first The first Matrix in the multiplication operation (on the left side).
+     * @param second The second Matrix in the multiplication operation (on the right side).
+     * @param result The Matrix which holds the result of the multiplication operation.
+     */
+    static void multiply(const TiledMatrix<T>& first, const TiledMatrix<T>& second,
+                         TiledMatrix<T>& result);
+
+    /**
+     * @brief Transpose the given Tiled Matrix into the given result Tiled Matrix, using the
+     *        in-memory Matrix Transpose on each tile (i.e. Complex tiles are conjugated).
+     *        If the dimensions or the tile sizes doesn't fit, an Exception will be thrown.
+     * @param matrix The Matrix to transpose.
+     * @param result The Matrix which holds the result of the Transpose operation.
+     */
+    static void trans(const TiledMatrix<T>& matrix, TiledMatrix<T>& result);
+
+private:
+
+    /**
+     * @brief A Tiled Matrix owns it's file, so it cannot be copied.
+     */
+    TiledMatrix(const TiledMatrix<T>& other) = delete;
+
+    /**
+     * @brief A Tiled Matrix owns it's file, so it cannot be assigned.
+     */
+    TiledMatrix<T>& operator=(const TiledMatrix<T>& other) = delete;
+
+    /**
+     * @brief The number of rows in the Matrix.
+     */
+    unsigned int _rows;
+
+    /**
+     * @brief The number of columns in the Matrix.
+     */
+    unsigned int _cols;
+
+    /**
+     * @brief The number of rows (and columns) in a single tile.
+     */
+    unsigned int _tileSize;
+
+    /**
+     * @brief The number of tiles in each column of tiles.
+     */
+    unsigned int _tileRows;
+
+    /**
+     * @brief The number of tiles in each row of tiles.
+     */
+    unsigned int _tileCols;
+
+    /**
+     * @brief The file which stores the tiles.
+     */
+    mutable std::fstream _file;
+
+    /**
+     * @brief A mutex which guards the file, so tiles can be read and written from background
+     *        threads.
+     */
+    mutable std::mutex _fileMutex;
+
+    /**
+     * @brief Returns the number of rows in the tiles of the given row of tiles.
+     * @param tileRow The row of tiles.
+     * @return The number of rows in the tiles.
+     */
+    unsigned int _tileHeight(unsigned int tileRow) const;
+
+    /**
+     * @brief Returns the number of columns in the tiles of the given column of tiles.
+     * @param tileCol The column of tiles.
+     * @return The number of columns in the tiles.
+     */
+    unsigned int _tileWidth(unsigned int tileCol) const;
+
+    /**
+     * @brief Returns the position of the given tile in the file. Each tile takes the space of
+     *        a full tile, and it's cells are stored row by row.
+     * @param tileRow The row of the tile.
+     * @param tileCol The column of the tile.
+     * @return The position of the tile in the file.
+     */
+    std::streamoff _tileOffset(unsigned int tileRow, unsigned int tileCol) const;
+
+    /**
+     * @brief Read the given number of cells from the given position in the file.
+     * @param offset The position in the file.
+     * @param cells The buffer to read the cells into.
+     * @param count The number of cells to read.
+     */
+    void _read(std::streamoff offset, T *cells, unsigned int count) const;
+
+    /**
+     * @brief Write the given number of cells to the given position in the file.
+     * @param offset The position in the file.
+     * @param cells The buffer of the cells to write.
+     * @param count The number of cells to write.
+     */
+    void _write(std::streamoff offset, const T *cells, unsigned int count);
+};
+
+
+#include "TiledMatrix.hpp"
+
+#endif
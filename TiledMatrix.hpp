@@ -0,0 +1,497 @@
+/**
+ * @file TiledMatrix.hpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 18 Oct 2026
+ *
+ * @brief An implementation of the Tiled Matrix Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * An implementation of the Tiled Matrix Class.
+ * The operations keep at most two sets of input tiles in memory: the tiles which are processed
+ * and the tiles which are prefetched by a background thread. The result tiles are written by
+ * a background thread as well, while the next result tile is computed.
+ */
+
+
+#ifndef _TILEDMATRIX_HPP
+#define _TILEDMATRIX_HPP
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <future>
+#include <utility>
+#include "TiledMatrix.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def FILE_MODE
+ * @brief A Macro that sets the mode in which the file of a Tiled Matrix is opened.
+ */
+#define FILE_MODE (std::ios::in | std::ios::out | std::ios::trunc | std::ios::binary)
+
+
+/*-----=  Constructors & Destructors  =-----*/
+
+
+/**
+ * @brief A Constructor for a Tiled Matrix which receives the path of it's file and the
+ *        desired dimensions, and creates the file (an existing file is truncated).
+ *        If one of the dimensions is invalid, or the tile size is zero, an Exception will
+ *        be thrown. If the file cannot be created, an Exception will be thrown.
+ * @param path The path of the file which stores the Matrix.
+ * @param rows The number of rows in the Matrix.
+ * @param cols The number of columns in the Matrix.
+ * @param tileSize The number of rows (and columns) in a single tile.
+ */
+template <class T>
+TiledMatrix<T>::TiledMatrix(const std::string& path, unsigned int rows, unsigned int cols,
+                            unsigned int tileSize)
+        : _rows(rows), _cols(cols), _tileSize(tileSize)
+{
+    if (((_rows == EMPTY_MATRIX_SIZE) ^ (_cols == EMPTY_MATRIX_SIZE)) ||
+        _tileSize == EMPTY_MATRIX_SIZE)
+    {
+        throw MatrixDimensionsException();
+    }
+    _tileRows = (_rows + _tileSize - 1) / _tileSize;
+    _tileCols = (_cols + _tileSize - 1) / _tileSize;
+
+    _file.open(path.c_str(), FILE_MODE);
+    if (!_file.is_open())
+    {
+        throw MatrixFileException();
+    }
+
+    // Extend the file to it's full size, so the tiles which were never written read as zeros.
+    std::streamoff size = _tileOffset(_tileRows, 0);
+    if (size > 0)
+    {
+        _file.seekp(size - 1);
+        _file.put(DEFAULT_VALUE);
+        if (!_file)
+        {
+            throw MatrixFileException();
+        }
+    }
+}
+
+/**
+ * @brief The Destructor for the Tiled Matrix, which closes it's file (but keeps it).
+ */
+template <class T>
+TiledMatrix<T>::~TiledMatrix()
+{
+    _file.close();
+}
+
+
+/*-----=  File Access  =-----*/
+
+
+/**
+ * @brief Returns the number of rows in the tiles of the given row of tiles.
+ * @param tileRow The row of tiles.
+ * @return The number of rows in the tiles.
+ */
+template <class T>
+unsigned int TiledMatrix<T>::_tileHeight(unsigned int tileRow) const
+{
+    return std::min(_tileSize, _rows - (tileRow * _tileSize));
+}
+
+/**
+ * @brief Returns the number of columns in the tiles of the given column of tiles.
+ * @param tileCol The column of tiles.
+ * @return The number of columns in the tiles.
+ */
+template <class T>
+unsigned int TiledMatrix<T>::_tileWidth(unsigned int tileCol) const
+{
+    return std::min(_tileSize, _cols - (tileCol * _tileSize));
+}
+
+/**
+ * @brief Returns the position of the given tile in the file. Each tile takes the space of
+ *        a full tile, and it's cells are stored row by row.
+ * @param tileRow The row of the tile.
+ * @param tileCol The column of the tile.
+ * @return The position of the tile in the file.
+ */
+template <class T>
+std::streamoff TiledMatrix<T>::_tileOffset(unsigned int tileRow, unsigned int tileCol) const
+{
+    std::streamoff tileIndex = ((std::streamoff) tileRow * _tileCols) + tileCol;
+    return tileIndex * _tileSize * _tileSize * (std::streamoff) sizeof(T);
+}
+
+/**
+ * @brief Read the given number of cells from the given position in the file.
+ * @param offset The position in the file.
+ * @param cells The buffer to read the cells into.
+ * @param count The number of cells to read.
+ */
+template <class T>
+void TiledMatrix<T>::_read(std::streamoff offset, T *cells, unsigned int count) const
+{
+    std::lock_guard<std::mutex> lock(_fileMutex);
+    _file.seekg(offset);
+    _file.read(reinterpret_cast<char *>(cells), (std::streamsize) count * sizeof(T));
+    if (!_file)
+    {
+        _file.clear();
+        throw MatrixFileException();
+    }
+}
+
+/**
+ * @brief Write the given number of cells to the given position in the file.
+ * @param offset The position in the file.
+ * @param cells The buffer of the cells to write.
+ * @param count The number of cells to write.
+ */
+template <class T>
+void TiledMatrix<T>::_write(std::streamoff offset, const T *cells, unsigned int count)
+{
+    std::lock_guard<std::mutex> lock(_fileMutex);
+    _file.seekp(offset);
+    _file.write(reinterpret_cast<const char *>(cells), (std::streamsize) count * sizeof(T));
+    if (!_file)
+    {
+        _file.clear();
+        throw MatrixFileException();
+    }
+}
+
+/**
+ * @brief Read a single tile from the file.
+ *        The tiles on the last row and column of tiles may be smaller than the tile size.
+ *        If the tile indices are invalid, an Exception will be thrown.
+ * @param tileRow The row of the tile.
+ * @param tileCol The column of the tile.
+ * @return A Matrix which holds the tile.
+ */
+template <class T>
+Matrix<T> TiledMatrix<T>::readTile(unsigned int tileRow, unsigned int tileCol) const
+{
+    if (tileRow >= _tileRows || tileCol >= _tileCols)
+    {
+        throw MatrixIndexException();
+    }
+
+    Matrix<T> tile(_tileHeight(tileRow), _tileWidth(tileCol));
+    _read(_tileOffset(tileRow, tileCol), tile._cells.data(), tile._rows * tile._cols);
+    return tile;
+}
+
+/**
+ * @brief Write a single tile to the file.
+ *        If the tile indices are invalid or if the given Matrix doesn't fit the tile
+ *        dimensions, an Exception will be thrown.
+ * @param tileRow The row of the tile.
+ * @param tileCol The column of the tile.
+ * @param tile The Matrix to write to the tile.
+ */
+template <class T>
+void TiledMatrix<T>::writeTile(unsigned int tileRow, unsigned int tileCol, const Matrix<T>& tile)
+{
+    if (tileRow >= _tileRows || tileCol >= _tileCols)
+    {
+        throw MatrixIndexException();
+    }
+    if (tile._rows != _tileHeight(tileRow) || tile._cols != _tileWidth(tileCol))
+    {
+        throw MatrixDimensionsException();
+    }
+
+    std::unique_ptr<Matrix<T>> scratch;
+    _write(_tileOffset(tileRow, tileCol), Matrix<T>::_packed(tile, scratch)._cells.data(),
+           tile._rows * tile._cols);
+}
+
+/**
+ * @brief Write a single row of the Matrix to the file, so a Matrix can be streamed into the
+ *        file row by row without holding it in memory.
+ *        If the row is invalid or the number of given cells doesn't fit the Matrix columns,
+ *        an Exception will be thrown.
+ * @param row The row to write.
+ * @param cells The cells of the row.
+ */
+template <class T>
+void TiledMatrix<T>::writeRow(unsigned int row, const std::vector<T>& cells)
+{
+    if (row >= _rows)
+    {
+        throw MatrixIndexException();
+    }
+    if (cells.size() != _cols)
+    {
+        throw MatrixDimensionsException();
+    }
+
+    const unsigned int tileRow = row / _tileSize;
+    const unsigned int rowInTile = row % _tileSize;
+    for (unsigned int tileCol = 0; tileCol < _tileCols; tileCol++)
+    {
+        const unsigned int width = _tileWidth(tileCol);
+        std::streamoff offset = _tileOffset(tileRow, tileCol) +
+                                ((std::streamoff) rowInTile * width * sizeof(T));
+        _write(offset, cells.data() + (tileCol * _tileSize), width);
+    }
+}
+
+/**
+ * @brief Write the given in-memory Matrix to the file.
+ *        If the dimensions of the given Matrix doesn't fit, an Exception will be thrown.
+ * @param matrix The Matrix to write.
+ */
+template <class T>
+void TiledMatrix<T>::load(const Matrix<T>& matrix)
+{
+    if (matrix._rows != _rows || matrix._cols != _cols)
+    {
+        throw MatrixDimensionsException();
+    }
+
+    std::unique_ptr<Matrix<T>> scratch;
+    const T *cells = Matrix<T>::_packed(matrix, scratch)._cells.data();
+    for (unsigned int row = 0; row < _rows; row++)
+    {
+        const unsigned int tileRow = row / _tileSize;
+        const unsigned int rowInTile = row % _tileSize;
+        for (unsigned int tileCol = 0; tileCol < _tileCols; tileCol++)
+        {
+            const unsigned int width = _tileWidth(tileCol);
+            std::streamoff offset = _tileOffset(tileRow, tileCol) +
+                                    ((std::streamoff) rowInTile * width * sizeof(T));
+            _write(offset, cells + (row * _cols) + (tileCol * _tileSize), width);
+        }
+    }
+}
+
+/**
+ * @brief Read the whole Matrix from the file into memory.
+ * @return An in-memory Matrix with the same data.
+ */
+template <class T>
+Matrix<T> TiledMatrix<T>::toMatrix() const
+{
+    Matrix<T> result(_rows, _cols);
+    for (unsigned int tileRow = 0; tileRow < _tileRows; tileRow++)
+    {
+        for (unsigned int tileCol = 0; tileCol < _tileCols; tileCol++)
+        {
+            const Matrix<T> tile = readTile(tileRow, tileCol);
+            for (unsigned int row = 0; row < tile._rows; row++)
+            {
+                std::copy(tile._cells.data() + (row * tile._cols),
+                          tile._cells.data() + ((row + 1) * tile._cols),
+                          result._cells.data() + (((tileRow * _tileSize) + row) * _cols) +
+                          (tileCol * _tileSize));
+            }
+        }
+    }
+    return result;
+}
+
+
+/*-----=  Tiled Operations  =-----*/
+
+
+/**
+ * @brief Add the two given Tiled Matrices into the given result Tiled Matrix, tile by tile.
+ *        If the dimensions or the tile sizes doesn't fit, an Exception will be thrown.
+ * @param first The first Matrix to add.
+ * @param second The second Matrix to add.
+ * @param result The Matrix which holds the result of the addition operation.
+ */
+template <class T>
+void TiledMatrix<T>::add(const TiledMatrix<T>& first, const TiledMatrix<T>& second,
+                         TiledMatrix<T>& result)
+{
+    if (first._rows != second._rows || first._cols != second._cols ||
+        result._rows != first._rows || result._cols != first._cols ||
+        first._tileSize != second._tileSize || result._tileSize != first._tileSize)
+    {
+        throw MatrixDimensionsException();
+    }
+
+    typedef std::pair<Matrix<T>, Matrix<T>> TilePair;
+    auto readPair = [&](unsigned int tileRow, unsigned int tileCol)
+    {
+        return TilePair(first.readTile(tileRow, tileCol), second.readTile(tileRow, tileCol));
+    };
+
+    const unsigned int tilesCount = first._tileRows * first._tileCols;
+    std::future<TilePair> prefetch;
+    std::future<void> pendingWrite;
+    if (tilesCount > 0)
+    {
+        prefetch = std::async(std::launch::async, readPair, 0, 0);
+    }
+    for (unsigned int tile = 0; tile < tilesCount; tile++)
+    {
+        const TilePair current = prefetch.get();
+        if (tile + 1 < tilesCount)
+        {
+            prefetch = std::async(std::launch::async, readPair, (tile + 1) / first._tileCols,
+                                  (tile + 1) % first._tileCols);
+        }
+
+        Matrix<T> sum = current.first + current.second;
+        if (pendingWrite.valid())
+        {
+            pendingWrite.get();
+        }
+        pendingWrite = std::async(std::launch::async, [&result, tile, sum]()
+        {
+            result.writeTile(tile / result._tileCols, tile % result._tileCols, sum);
+        });
+    }
+    if (pendingWrite.valid())
+    {
+        pendingWrite.get();
+    }
+}
+
+/**
+ * @brief Multiply the two given Tiled Matrices into the given result Tiled Matrix.
+ *        Each result tile is accumulated from the products of a row of tiles of the first
+ *        Matrix with a column of tiles of the second Matrix.
+ *        If the dimensions or the tile sizes doesn't fit, an Exception will be thrown.
+ * @param first The first Matrix in the multiplication operation (on the left side).
+ * @param second The second Matrix in the multiplication operation (on the right side).
+ * @param result The Matrix which holds the result of the multiplication operation.
+ */
+template <class T>
+void TiledMatrix<T>::multiply(const TiledMatrix<T>& first, const TiledMatrix<T>& second,
+                              TiledMatrix<T>& result)
+{
+    if (first._cols != second._rows || result._rows != first._rows ||
+        result._cols != second._cols || first._tileSize != second._tileSize ||
+        result._tileSize != first._tileSize)
+    {
+        throw MatrixDimensionsException();
+    }
+
+    typedef std::pair<Matrix<T>, Matrix<T>> TilePair;
+    auto readPair = [&](unsigned int tileRow, unsigned int tileCol, unsigned int inner)
+    {
+        return TilePair(first.readTile(tileRow, inner), second.readTile(inner, tileCol));
+    };
+
+    // The steps are all the (row, column, inner) triplets of tiles, and the tiles of the next
+    // step are always prefetched while the current step is multiplied.
+    const unsigned int innerCount = first._tileCols;
+    const unsigned int stepsCount = result._tileRows * result._tileCols * innerCount;
+    std::future<TilePair> prefetch;
+    std::future<void> pendingWrite;
+    if (stepsCount > 0)
+    {
+        prefetch = std::async(std::launch::async, readPair, 0, 0, 0);
+    }
+
+    for (unsigned int step = 0; step < stepsCount; step += innerCount)
+    {
+        const unsigned int tileRow = (step / innerCount) / result._tileCols;
+        const unsigned int tileCol = (step / innerCount) % result._tileCols;
+        Matrix<T> accumulator(result._tileHeight(tileRow), result._tileWidth(tileCol));
+        Matrix<T> product(accumulator._rows, accumulator._cols);
+
+        for (unsigned int inner = 0; inner < innerCount; inner++)
+        {
+            const TilePair current = prefetch.get();
+            const unsigned int next = step + inner + 1;
+            if (next < stepsCount)
+            {
+                prefetch = std::async(std::launch::async, readPair,
+                                      (next / innerCount) / result._tileCols,
+                                      (next / innerCount) % result._tileCols, next % innerCount);
+            }
+
+            Matrix<T>::_multiply(product, current.first, current.second);
+            for (unsigned int i = 0; i < accumulator._cells.size(); i++)
+            {
+                accumulator._cells[i] += product._cells[i];
+            }
+        }
+
+        if (pendingWrite.valid())
+        {
+            pendingWrite.get();
+        }
+        pendingWrite = std::async(std::launch::async, [&result, tileRow, tileCol, accumulator]()
+        {
+            result.writeTile(tileRow, tileCol, accumulator);
+        });
+    }
+    if (pendingWrite.valid())
+    {
+        pendingWrite.get();
+    }
+}
+
+/**
+ * @brief Transpose the given Tiled Matrix into the given result Tiled Matrix, using the
+ *        in-memory Matrix Transpose on each tile (i.e. Complex tiles are conjugated).
+ *        If the dimensions or the tile sizes doesn't fit, an Exception will be thrown.
+ * @param matrix The Matrix to transpose.
+ * @param result The Matrix which holds the result of the Transpose operation.
+ */
+template <class T>
+void TiledMatrix<T>::trans(const TiledMatrix<T>& matrix, TiledMatrix<T>& result)
+{
+    if (result._rows != matrix._cols || result._cols != matrix._rows ||
+        result._tileSize != matrix._tileSize)
+    {
+        throw MatrixDimensionsException();
+    }
+
+    auto readTileAt = [&](unsigned int tileRow, unsigned int tileCol)
+    {
+        return matrix.readTile(tileRow, tileCol);
+    };
+
+    const unsigned int tilesCount = matrix._tileRows * matrix._tileCols;
+    std::future<Matrix<T>> prefetch;
+    std::future<void> pendingWrite;
+    if (tilesCount > 0)
+    {
+        prefetch = std::async(std::launch::async, readTileAt, 0, 0);
+    }
+    for (unsigned int tile = 0; tile < tilesCount; tile++)
+    {
+        const Matrix<T> current = prefetch.get();
+        if (tile + 1 < tilesCount)
+        {
+            prefetch = std::async(std::launch::async, readTileAt, (tile + 1) / matrix._tileCols,
+                                  (tile + 1) % matrix._tileCols);
+        }
+
+        Matrix<T> transposed = current.trans();
+        const unsigned int tileRow = tile % matrix._tileCols;
+        const unsigned int tileCol = tile / matrix._tileCols;
+        if (pendingWrite.valid())
+        {
+            pendingWrite.get();
+        }
+        pendingWrite = std::async(std::launch::async, [&result, tileRow, tileCol, transposed]()
+        {
+            result.writeTile(tileRow, tileCol, transposed);
+        });
+    }
+    if (pendingWrite.valid())
+    {
+        pendingWrite.get();
+    }
+}
+
+#endif